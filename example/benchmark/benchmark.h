@@ -0,0 +1,67 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+namespace benchmark {
+
+/**
+ * @brief Prints the average time of processing an element by @c f
+ *
+ * @c f processes @c count elements and returns a value depending on all of them so that the
+ * work cannot be optimized away. It is run once to warm up the caches and then @c repeats times.
+ */
+template<typename F>
+void run(std::string_view name, std::size_t count, F f, int repeats = 20)
+{
+  auto checksum = f();
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < repeats; ++i) checksum += f();
+  const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  std::cout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(3) << std::setw(8)
+            << elapsed.count() / (static_cast<double>(count) * repeats) << " ns/element  (checksum " << checksum
+            << ")\n";
+}
+
+/**
+ * @brief Prints the throughput of @c f processing @c bytes of memory (read and written)
+ *
+ * Runs @c f the same way as @c run().
+ */
+template<typename F>
+void run_throughput(std::string_view name, std::size_t bytes, F f, int repeats = 20)
+{
+  auto checksum = f();
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < repeats; ++i) checksum += f();
+  const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  std::cout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(3) << std::setw(8)
+            << static_cast<double>(bytes) * repeats / elapsed.count() << " GB/s  (checksum " << checksum << ")\n";
+}
+
+}  // namespace benchmark
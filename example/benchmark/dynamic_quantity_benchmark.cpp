@@ -0,0 +1,117 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.h"
+#include <units/dynamic_quantity.h>
+#include <units/physical/si/base/length.h>
+#include <units/physical/si/base/time.h>
+#include <units/physical/si/derived/speed.h>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+  compares the arithmetic on `dynamic_quantity` (with the exponents of its dimension packed into
+  a single 64-bit word) with the one on `quantity` and on a naive quantity with the exponents
+  stored in a `std::map<std::string, int>`
+*/
+
+namespace {
+
+using namespace units::physical;
+
+// a naive runtime quantity storing the exponents of its dimension by the symbols of base dimensions
+struct map_quantity {
+  double value;
+  std::map<std::string, int> dimension;
+
+  friend map_quantity operator+(const map_quantity& lhs, const map_quantity& rhs)
+  {
+    if (lhs.dimension != rhs.dimension) throw std::invalid_argument("dimensions do not match");
+    return {lhs.value + rhs.value, lhs.dimension};
+  }
+
+  friend map_quantity operator/(const map_quantity& lhs, const map_quantity& rhs)
+  {
+    map_quantity res{lhs.value / rhs.value, lhs.dimension};
+    for (const auto& [symbol, exponent] : rhs.dimension)
+      if ((res.dimension[symbol] -= exponent) == 0) res.dimension.erase(symbol);
+    return res;
+  }
+};
+
+}  // namespace
+
+int main()
+{
+  constexpr std::size_t count = 1'000'000;
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(1., 100.);
+  std::vector<si::length<si::metre>> d1, d2;
+  std::vector<si::time<si::second>> t1, t2;
+  for (auto* v : {&d1, &d2}) {
+    v->reserve(count);
+    for (std::size_t i = 0; i < count; ++i) v->emplace_back(dist(gen));
+  }
+  for (auto* v : {&t1, &t2}) {
+    v->reserve(count);
+    for (std::size_t i = 0; i < count; ++i) v->emplace_back(dist(gen));
+  }
+
+  const auto to_dynamic = [](const auto& v) { return std::vector<units::dynamic_quantity>(v.begin(), v.end()); };
+  const auto to_map = [](const auto& v, const char* symbol) {
+    std::vector<map_quantity> res;
+    res.reserve(v.size());
+    for (const auto& q : v) res.push_back({q.count(), {{symbol, 1}}});
+    return res;
+  };
+  const auto dd1 = to_dynamic(d1), dd2 = to_dynamic(d2), dt1 = to_dynamic(t1), dt2 = to_dynamic(t2);
+  const auto md1 = to_map(d1, "L"), md2 = to_map(d2, "L"), mt1 = to_map(t1, "T"), mt2 = to_map(t2, "T");
+
+  benchmark::run("d1 / t1 + d2 / t2   quantity", count, [&] {
+    double sum = 0;
+    for (std::size_t i = 0; i < count; ++i) sum += (d1[i] / t1[i] + d2[i] / t2[i]).count();
+    return sum;
+  });
+
+  benchmark::run("d1 / t1 + d2 / t2   dynamic_quantity", count, [&] {
+    double sum = 0;
+    for (std::size_t i = 0; i < count; ++i) sum += (dd1[i] / dt1[i] + dd2[i] / dt2[i]).base_value();
+    return sum;
+  });
+
+  benchmark::run("d1 / t1 + d2 / t2   std::map dimension", count, [&] {
+    double sum = 0;
+    for (std::size_t i = 0; i < count; ++i) sum += (md1[i] / mt1[i] + md2[i] / mt2[i]).value;
+    return sum;
+  });
+
+  benchmark::run("quantity_cast<speed>(dynamic_quantity)", count, [&] {
+    double sum = 0;
+    for (std::size_t i = 0; i < count; ++i)
+      sum += units::quantity_cast<si::speed<si::metre_per_second>>(dd1[i] / dt1[i]).count();
+    return sum;
+  });
+}
@@ -0,0 +1,104 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.h"
+#include <units/format.h>
+#include <units/physical/si/base/length.h>
+#include <units/physical/si/derived/energy.h>
+#include <units/physical/si/derived/speed.h>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <vector>
+
+/*
+  compares formatting quantities of different units (sharing a single formatter for the same
+  representation type) with formatting their raw values followed by the unit symbols
+*/
+
+namespace {
+
+using namespace units::physical;
+
+template<typename Q>
+std::vector<Q> make_values(std::size_t count)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(0., 100.);
+  std::vector<Q> values;
+  values.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) values.emplace_back(dist(gen));
+  return values;
+}
+
+}  // namespace
+
+int main()
+{
+  constexpr std::size_t count = 1'000'000;
+
+  const auto lengths = make_values<si::length<si::metre>>(count);
+  const auto speeds = make_values<si::speed<si::kilometre_per_hour>>(count);
+  const auto energies = make_values<si::energy<si::joule>>(count);
+
+  fmt::memory_buffer buf;
+
+  benchmark::run("raw values + symbols  {} m", 3 * count, [&] {
+    buf.clear();
+    for (std::size_t i = 0; i < count; ++i) {
+      fmt::format_to(std::back_inserter(buf), "{} m", lengths[i].count());
+      fmt::format_to(std::back_inserter(buf), "{} km/h", speeds[i].count());
+      fmt::format_to(std::back_inserter(buf), "{} J", energies[i].count());
+    }
+    return buf.size();
+  });
+
+  benchmark::run("quantities            {}", 3 * count, [&] {
+    buf.clear();
+    for (std::size_t i = 0; i < count; ++i) {
+      fmt::format_to(std::back_inserter(buf), "{}", lengths[i]);
+      fmt::format_to(std::back_inserter(buf), "{}", speeds[i]);
+      fmt::format_to(std::back_inserter(buf), "{}", energies[i]);
+    }
+    return buf.size();
+  });
+
+  benchmark::run("quantities            {:%.2Q %q}", 3 * count, [&] {
+    buf.clear();
+    for (std::size_t i = 0; i < count; ++i) {
+      fmt::format_to(std::back_inserter(buf), "{:%.2Q %q}", lengths[i]);
+      fmt::format_to(std::back_inserter(buf), "{:%.2Q %q}", speeds[i]);
+      fmt::format_to(std::back_inserter(buf), "{:%.2Q %q}", energies[i]);
+    }
+    return buf.size();
+  });
+
+  benchmark::run("quantities            {:>16}", 3 * count, [&] {
+    buf.clear();
+    for (std::size_t i = 0; i < count; ++i) {
+      fmt::format_to(std::back_inserter(buf), "{:>16}", lengths[i]);
+      fmt::format_to(std::back_inserter(buf), "{:>16}", speeds[i]);
+      fmt::format_to(std::back_inserter(buf), "{:>16}", energies[i]);
+    }
+    return buf.size();
+  });
+}
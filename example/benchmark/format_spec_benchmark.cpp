@@ -0,0 +1,102 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.h"
+#include <units/format.h>
+#include <fmt/compile.h>
+#include <units/physical/si/base/length.h>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+  compares `fmt::format()` of a quantity, with the format specification resolved once in `parse()`,
+  with `fmt::format()` of its raw value followed by the unit symbol in the format string
+*/
+
+int main()
+{
+  using namespace units::physical;
+
+  constexpr std::size_t count = 1'000'000;
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(0., 100.);
+  std::vector<si::length<si::metre>> lengths;
+  lengths.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) lengths.emplace_back(dist(gen));
+
+  benchmark::run("fmt::format(\"{} m\", double)", count, [&] {
+    std::size_t size = 0;
+    for (const auto& l : lengths) size += fmt::format("{} m", l.count()).size();
+    return size;
+  });
+
+  benchmark::run("fmt::format(\"{:g} m\", double)", count, [&] {
+    std::size_t size = 0;
+    for (const auto& l : lengths) size += fmt::format("{:g} m", l.count()).size();
+    return size;
+  });
+
+  benchmark::run("fmt::format(\"{}\", quantity)", count, [&] {
+    std::size_t size = 0;
+    for (const auto& l : lengths) size += fmt::format("{}", l).size();
+    return size;
+  });
+
+  benchmark::run("FMT_COMPILE(\"{:g} m\"), double", count, [&] {
+    std::size_t size = 0;
+    for (const auto& l : lengths) size += fmt::format(FMT_COMPILE("{:g} m"), l.count()).size();
+    return size;
+  });
+
+  benchmark::run("FMT_COMPILE(\"{}\"), quantity", count, [&] {
+    std::size_t size = 0;
+    for (const auto& l : lengths) size += fmt::format(FMT_COMPILE("{}"), l).size();
+    return size;
+  });
+
+  benchmark::run("fmt::format(\"{:.2f} m\", double)", count, [&] {
+    std::size_t size = 0;
+    for (const auto& l : lengths) size += fmt::format("{:.2f} m", l.count()).size();
+    return size;
+  });
+
+  benchmark::run("fmt::format(\"{:%.2Q %q}\", quantity)", count, [&] {
+    std::size_t size = 0;
+    for (const auto& l : lengths) size += fmt::format("{:%.2Q %q}", l).size();
+    return size;
+  });
+
+  benchmark::run("fmt::format(\"{:*>14.2f} m\", double)", count, [&] {
+    std::size_t size = 0;
+    for (const auto& l : lengths) size += fmt::format("{:*>14.2f} m", l.count()).size();
+    return size;
+  });
+
+  benchmark::run("fmt::format(\"{:*>16%.2Q %q}\", quantity)", count, [&] {
+    std::size_t size = 0;
+    for (const auto& l : lengths) size += fmt::format("{:*>16%.2Q %q}", l).size();
+    return size;
+  });
+}
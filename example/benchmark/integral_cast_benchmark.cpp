@@ -0,0 +1,184 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.h"
+#include <units/physical/si/base/time.h>
+#include <units/physical/si/fps/base/length.h>
+#include <units/physical/si/base/length.h>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/*
+  compares the integral `quantity_cast` (overflow-free and without a division instruction)
+  with the plain `v * multiplier / divisor` expressions it replaces
+
+  the casts between SI prefixed time units are measured for every pair of units with the ratio
+  expressible as an integral multiplier and divisor, and with values not overflowing the target
+*/
+
+namespace {
+
+using namespace units::physical;
+
+// a unit with the multiplier and the divisor of its ratio so large that their 128-bit product is needed
+struct odd_unit : units::named_scaled_unit<odd_unit, "odd", units::no_prefix, units::ratio(3'000'000'019, 7'000'000'001), si::metre> {};
+
+template<typename To, typename From>
+std::int64_t cast_all(const std::vector<From>& from, std::vector<To>& to)
+{
+  std::int64_t sum = 0;
+  for (std::size_t i = 0; i < from.size(); ++i) {
+    to[i] = units::quantity_cast<To>(from[i]);
+    sum += to[i].count();
+  }
+  return sum;
+}
+
+template<std::int64_t Multiplier, std::int64_t Divisor>
+std::int64_t scale_all(const std::vector<std::int64_t>& from, std::vector<std::int64_t>& to)
+{
+  std::int64_t sum = 0;
+  for (std::size_t i = 0; i < from.size(); ++i) {
+    to[i] = from[i] * Multiplier / Divisor;
+    sum += to[i];
+  }
+  return sum;
+}
+
+std::vector<std::int64_t> random_values(std::size_t count, std::int64_t max)
+{
+  std::mt19937_64 gen(42);
+  std::uniform_int_distribution<std::int64_t> dist(-max, max);
+  std::vector<std::int64_t> values(count);
+  for (auto& v : values) v = dist(gen);
+  return values;
+}
+
+template<typename Q>
+std::vector<Q> to_quantities(const std::vector<std::int64_t>& values)
+{
+  std::vector<Q> res;
+  res.reserve(values.size());
+  for (auto v : values) res.emplace_back(static_cast<typename Q::rep>(v));
+  return res;
+}
+
+template<typename Rep>
+constexpr const char* rep_name = std::numeric_limits<Rep>::digits > 31 ? "int64" : "int32";
+
+// the cast of Rep values between two time units and the `v * multiplier / divisor` computed in `std::intmax_t`
+template<typename Rep, typename FromUnit, typename ToUnit>
+void time_cast(std::size_t count)
+{
+  using from_type = si::time<FromUnit, Rep>;
+  using to_type = si::time<ToUnit, Rep>;
+  constexpr units::ratio r = units::detail::cast_ratio(from_type(), to_type());
+  if constexpr (!std::same_as<FromUnit, ToUnit> && units::detail::has_integral_factor(r)) {
+    constexpr units::detail::integral_factor f = units::detail::make_integral_factor(r);
+    constexpr std::int64_t max = std::numeric_limits<Rep>::max() / f.multiplier;
+    if constexpr (max > 0) {
+      const auto values = random_values(count, max);
+      const auto from = to_quantities<from_type>(values);
+      std::vector<to_type> to(count);
+      std::vector<Rep> raw(count);
+      const std::string name =
+        std::string(rep_name<Rep>) + " " + FromUnit::symbol.ascii().c_str() + " -> " + ToUnit::symbol.ascii().c_str();
+      benchmark::run(name + "   v * m / d", count, [&] {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+          raw[i] = static_cast<Rep>(static_cast<std::intmax_t>(from[i].count()) * f.multiplier / f.divisor);
+          sum += raw[i];
+        }
+        return sum;
+      });
+      benchmark::run(name + "   quantity_cast", count, [&] { return cast_all(from, to); });
+    }
+  }
+}
+
+template<typename Rep, typename FromUnit, typename... ToUnits>
+void time_casts_from(std::size_t count)
+{
+  (time_cast<Rep, FromUnit, ToUnits>(count), ...);
+}
+
+template<typename Rep, typename... Units>
+void time_casts(std::size_t count, std::tuple<Units...>)
+{
+  (time_casts_from<Rep, Units, Units...>(count), ...);
+}
+
+using prefixed_time_units = std::tuple<si::yoctosecond, si::zeptosecond, si::attosecond, si::femtosecond, si::picosecond,
+                                       si::nanosecond, si::microsecond, si::millisecond, si::second>;
+
+}  // namespace
+
+int main()
+{
+  constexpr std::size_t count = 1'000'000;
+  std::vector<std::int64_t> raw(count);
+
+  // ns -> ms: a division by a constant
+  {
+    const auto values = random_values(count, INT64_MAX);
+    const auto from = to_quantities<si::time<si::nanosecond, std::int64_t>>(values);
+    std::vector<si::time<si::millisecond, std::int64_t>> to(count);
+    benchmark::run("ns -> ms   v / 1000000", count, [&] { return scale_all<1, 1'000'000>(values, raw); });
+    benchmark::run("ns -> ms   quantity_cast", count, [&] { return cast_all(from, to); });
+  }
+
+  // ft -> mm: a product that may overflow for values above INT64_MAX / 1524
+  {
+    const auto values = random_values(count, INT64_MAX / 1524);
+    const auto from = to_quantities<si::fps::length<si::fps::foot, std::int64_t>>(values);
+    std::vector<si::length<si::millimetre, std::int64_t>> to(count);
+    benchmark::run("ft -> mm   v * 1524 / 5", count, [&] { return scale_all<1524, 5>(values, raw); });
+    benchmark::run("ft -> mm   quantity_cast", count, [&] { return cast_all(from, to); });
+  }
+
+  // m -> odd: a 128-bit product
+  {
+    const auto values = random_values(count, INT64_MAX / 3);
+    const auto from = to_quantities<si::length<odd_unit, std::int64_t>>(values);
+    std::vector<si::length<si::metre, std::int64_t>> to(count);
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef __int128 int128_t;
+    benchmark::run("odd -> m   __int128 v * m / d", count, [&] {
+      std::int64_t sum = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+        raw[i] = static_cast<std::int64_t>(static_cast<int128_t>(values[i]) * 3'000'000'019 / 7'000'000'001);
+        sum += raw[i];
+      }
+      return sum;
+    });
+#endif
+    benchmark::run("odd -> m   quantity_cast", count, [&] { return cast_all(from, to); });
+  }
+
+  // every pair of SI prefixed time units
+  time_casts<std::int32_t>(count, prefixed_time_units());
+  time_casts<std::int64_t>(count, prefixed_time_units());
+}
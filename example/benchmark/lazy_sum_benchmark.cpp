@@ -0,0 +1,110 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.h"
+#include <units/lazy.h>
+#include <units/physical/si/base/length.h>
+#include <units/physical/si/derived/energy.h>
+#include <units/physical/si/derived/force.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/*
+  compares eager sums of quantities of different units, scaling every intermediate result to the
+  common unit of its two operands, with the deferred ones started with `lazy()` scaling every term
+  only once
+*/
+
+namespace {
+
+using namespace units::physical;
+
+template<typename Q>
+std::vector<Q> random_quantities(std::size_t count)
+{
+  std::mt19937_64 gen(42);
+  std::vector<Q> res;
+  res.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    if constexpr (std::is_floating_point_v<typename Q::rep>)
+      res.emplace_back(std::uniform_real_distribution<typename Q::rep>(0, 100)(gen));
+    else
+      res.emplace_back(std::uniform_int_distribution<typename Q::rep>(0, 100)(gen));
+  }
+  return res;
+}
+
+template<typename Rep>
+void long_sums(std::size_t count)
+{
+  const auto a = random_quantities<si::length<si::kilometre, Rep>>(count);
+  const auto b = random_quantities<si::length<si::metre, Rep>>(count);
+  const auto c = random_quantities<si::length<si::millimetre, Rep>>(count);
+  const auto d = random_quantities<si::length<si::micrometre, Rep>>(count);
+
+  benchmark::run(std::is_integral_v<Rep> ? "km + m + mm + um   eager int64" : "km + m + mm + um   eager double", count, [&] {
+    Rep sum = 0;
+    for (std::size_t i = 0; i < count; ++i) sum += (a[i] + b[i] + c[i] + d[i]).count();
+    return sum;
+  });
+
+  benchmark::run(std::is_integral_v<Rep> ? "km + m + mm + um   lazy int64" : "km + m + mm + um   lazy double", count, [&] {
+    Rep sum = 0;
+    for (std::size_t i = 0; i < count; ++i) sum += (units::lazy(a[i]) + b[i] + c[i] + d[i]).eval().count();
+    return sum;
+  });
+}
+
+}  // namespace
+
+int main()
+{
+  constexpr std::size_t count = 1'000'000;
+
+  long_sums<std::int64_t>(count);
+  long_sums<double>(count);
+
+  // dot-product-like sums of products of forces and lengths in different units
+  {
+    const auto f1 = random_quantities<si::force<si::kilonewton>>(count);
+    const auto d1 = random_quantities<si::length<si::metre>>(count);
+    const auto f2 = random_quantities<si::force<si::newton>>(count);
+    const auto d2 = random_quantities<si::length<si::kilometre>>(count);
+    const auto f3 = random_quantities<si::force<si::millinewton>>(count);
+    const auto d3 = random_quantities<si::length<si::millimetre>>(count);
+
+    benchmark::run("f1 * d1 + f2 * d2 + f3 * d3   eager", count, [&] {
+      double sum = 0;
+      for (std::size_t i = 0; i < count; ++i)
+        sum += units::quantity_cast<si::joule>(f1[i] * d1[i] + f2[i] * d2[i] + f3[i] * d3[i]).count();
+      return sum;
+    });
+
+    benchmark::run("f1 * d1 + f2 * d2 + f3 * d3   lazy", count, [&] {
+      double sum = 0;
+      for (std::size_t i = 0; i < count; ++i)
+        sum += units::quantity_cast<si::joule>((units::lazy(f1[i] * d1[i]) + f2[i] * d2[i] + f3[i] * d3[i]).eval()).count();
+      return sum;
+    });
+  }
+}
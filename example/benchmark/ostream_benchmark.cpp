@@ -0,0 +1,99 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.h"
+#include <units/physical/si/base/length.h>
+#include <units/physical/si/derived/speed.h>
+#include <units/quantity_io.h>
+#include <cstddef>
+#include <iomanip>
+#include <locale>
+#include <ostream>
+#include <random>
+#include <streambuf>
+#include <vector>
+
+/*
+  compares writing padded quantities to a stream with the classic locale (written with
+  `std::to_chars()` directly to the stream buffer) with the generic path taken for other
+  locales and with writing the raw values and the unit symbols by hand
+*/
+
+namespace {
+
+using namespace units::physical;
+
+// discards the output counting the characters written
+class counting_buffer : public std::streambuf {
+  std::size_t count_ = 0;
+
+protected:
+  int_type overflow(int_type c) override
+  {
+    ++count_;
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize xsputn(const char_type*, std::streamsize n) override
+  {
+    count_ += static_cast<std::size_t>(n);
+    return n;
+  }
+
+public:
+  [[nodiscard]] std::size_t count() const { return count_; }
+};
+
+// a locale different from the classic one but formatting numbers in the same way
+std::locale custom_locale() { return std::locale(std::locale::classic(), new std::numpunct<char>); }
+
+}  // namespace
+
+int main()
+{
+  constexpr std::size_t count = 10'000'000;
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(0., 100.);
+  std::vector<si::speed<si::metre_per_second>> speeds;
+  speeds.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) speeds.emplace_back(dist(gen));
+
+  counting_buffer buf;
+  std::ostream os(&buf);
+
+  benchmark::run("setw(12) raw value + \" m/s\"", count, [&] {
+    for (const auto& v : speeds) os << std::setw(12) << v.count() << " m/s";
+    return buf.count();
+  }, 3);
+
+  benchmark::run("setw(16) quantity, classic locale", count, [&] {
+    for (const auto& v : speeds) os << std::setw(16) << v;
+    return buf.count();
+  }, 3);
+
+  os.imbue(custom_locale());
+  benchmark::run("setw(16) quantity, other locale", count, [&] {
+    for (const auto& v : speeds) os << std::setw(16) << v;
+    return buf.count();
+  }, 3);
+}
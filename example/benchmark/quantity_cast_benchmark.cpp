@@ -0,0 +1,105 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.h"
+#include <units/bits/pow.h>
+#include <units/physical/si/base/length.h>
+#include <units/physical/si/base/time.h>
+#include <units/quantity_cast.h>
+#include <random>
+#include <vector>
+
+/*
+  compares the floating-point `quantity_cast` using `conversion_factor_v` computed at compile time
+  with the previous implementation computing the factor from the ratio of units on every cast
+
+  built at -O0, -O1, and -O2 as `quantity_cast_benchmark_O0`, `quantity_cast_benchmark_O1`, and
+  `quantity_cast_benchmark_O2` to show the cost of the cast in unoptimized builds
+*/
+
+namespace {
+
+using namespace units::physical;
+
+// the floating-point branch of `quantity_cast` before `conversion_factor_v`
+template<typename To, typename From>
+To runtime_factor_cast(const From& q)
+{
+  constexpr units::ratio r = units::detail::cast_ratio(From(), To());
+  return To(q.count() * (static_cast<double>(r.num) * units::detail::fpow10<double>(r.exp) / static_cast<double>(r.den)));
+}
+
+template<typename To, typename From, typename Cast>
+void run(std::string_view name, const std::vector<From>& from, Cast cast)
+{
+  std::vector<To> to(from.size());
+  benchmark::run(name, from.size(), [&] {
+    double sum = 0;
+    for (std::size_t i = 0; i < from.size(); ++i) {
+      to[i] = cast(from[i]);
+      sum += to[i].count();
+    }
+    return sum;
+  });
+}
+
+template<typename Q>
+std::vector<Q> random_quantities(std::size_t count)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1000., 1000.);
+  std::vector<Q> res;
+  res.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) res.emplace_back(dist(gen));
+  return res;
+}
+
+}  // namespace
+
+int main()
+{
+  constexpr std::size_t count = 1'000'000;
+
+  {
+    using from = si::length<si::millimetre>;
+    using to = si::length<si::metre>;
+    const auto values = random_quantities<from>(count);
+    run<to>("mm -> m    runtime factor", values, [](const from& q) { return runtime_factor_cast<to>(q); });
+    run<to>("mm -> m    quantity_cast", values, [](const from& q) { return units::quantity_cast<to>(q); });
+  }
+
+  {
+    using from = si::length<si::kilometre>;
+    using to = si::length<si::micrometre>;
+    const auto values = random_quantities<from>(count);
+    run<to>("km -> um   runtime factor", values, [](const from& q) { return runtime_factor_cast<to>(q); });
+    run<to>("km -> um   quantity_cast", values, [](const from& q) { return units::quantity_cast<to>(q); });
+  }
+
+  {
+    using from = si::time<si::millisecond>;
+    using to = si::time<si::hour>;
+    const auto values = random_quantities<from>(count);
+    run<to>("ms -> h    runtime factor", values, [](const from& q) { return runtime_factor_cast<to>(q); });
+    run<to>("ms -> h    quantity_cast", values, [](const from& q) { return units::quantity_cast<to>(q); });
+  }
+}
@@ -0,0 +1,100 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.h"
+#include <units/physical/si/base/length.h>
+#include <units/physical/si/base/time.h>
+#include <units/quantity_point.h>
+#include <units/soa_vector.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+/*
+  compares scans over a single field of track points stored as an array of structures
+  (`std::vector<flight_point>`) and as a structure of arrays (`soa_vector`)
+*/
+
+namespace {
+
+using namespace units;
+using namespace units::physical;
+
+using duration = si::time<si::second>;
+using distance = si::length<si::kilometre>;
+using altitude = quantity_point<si::dim_length, si::metre>;
+
+struct flight_point {
+  duration dur;
+  distance dist;
+  altitude alt;
+};
+
+}  // namespace
+
+int main()
+{
+  constexpr std::size_t count = 4'000'000;
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(0., 1.);
+  std::vector<flight_point> aos;
+  aos.reserve(count);
+  soa_vector<duration, distance, altitude> soa;
+  soa.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const flight_point p{duration(static_cast<double>(i)), distance(dist(gen)), altitude(si::length<si::metre>(1000. * dist(gen)))};
+    aos.push_back(p);
+    soa.push_back(p.dur, p.dist, p.alt);
+  }
+
+  benchmark::run("sum of distances   AoS std::vector", count, [&] {
+    distance sum = distance::zero();
+    for (const auto& p : aos) sum += p.dist;
+    return sum.count();
+  });
+
+  benchmark::run("sum of distances   SoA column", count, [&] {
+    distance sum = distance::zero();
+    for (const auto& d : soa.column<1>()) sum += d;
+    return sum.count();
+  });
+
+  benchmark::run("sum of distances   SoA proxy refs", count, [&] {
+    distance sum = distance::zero();
+    for (const auto& p : soa) sum += get<1>(p);
+    return sum.count();
+  });
+
+  benchmark::run("max altitude       AoS std::vector", count, [&] {
+    altitude max = aos.front().alt;
+    for (const auto& p : aos) max = std::max(max, p.alt);
+    return max.relative().count();
+  });
+
+  benchmark::run("max altitude       SoA column", count, [&] {
+    const auto alts = soa.column<2>();
+    altitude max = alts.front();
+    for (const auto& a : alts) max = std::max(max, a);
+    return max.relative().count();
+  });
+}
@@ -0,0 +1,90 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.h"
+#include <units/physical/si/base/length.h>
+#include <units/quantity_cast.h>
+#include <random>
+#include <span>
+#include <vector>
+
+/*
+  compares the throughput (bytes read and written) of the `quantity_cast` overloads for contiguous
+  ranges with a loop multiplying raw values by the same factor and a loop casting quantities one by one
+*/
+
+namespace {
+
+using namespace units::physical;
+
+using millimetres = si::length<si::millimetre, float>;
+using metres = si::length<si::metre, float>;
+
+}  // namespace
+
+int main()
+{
+  constexpr std::size_t count = 1'000'000;
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<float> dist(-1000.f, 1000.f);
+  std::vector<float> raw(count);
+  std::vector<millimetres> frame;
+  frame.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    raw[i] = dist(gen);
+    frame.emplace_back(raw[i]);
+  }
+  std::vector<float> raw_result(count);
+  std::vector<metres> result(count);
+
+  // every element is read and written once
+  constexpr std::size_t bytes = 2 * count * sizeof(float);
+
+  benchmark::run_throughput("mm -> m   raw float loop * 0.001f", bytes, [&] {
+    for (std::size_t i = 0; i < count; ++i) raw_result[i] = raw[i] * 0.001f;
+    return raw_result[count / 2];
+  });
+
+  benchmark::run_throughput("mm -> m   quantity_cast per element", bytes, [&] {
+    for (std::size_t i = 0; i < count; ++i) result[i] = units::quantity_cast<metres>(frame[i]);
+    return result[count / 2].count();
+  });
+
+  benchmark::run_throughput("mm -> m   quantity_cast(span, span)", bytes, [&] {
+    units::quantity_cast<metres>(std::span<const millimetres>(frame), std::span(result));
+    return result[count / 2].count();
+  });
+
+  // converts back and forth so the values stay in range
+  benchmark::run_throughput("mm <-> m  raw float loop in-place", 2 * bytes, [&] {
+    for (std::size_t i = 0; i < count; ++i) raw[i] = raw[i] * 0.001f;
+    for (std::size_t i = 0; i < count; ++i) raw[i] = raw[i] * 1000.f;
+    return raw[count / 2];
+  });
+
+  benchmark::run_throughput("mm <-> m  quantity_cast(span) in-place", 2 * bytes, [&] {
+    const auto m = units::quantity_cast<metres>(std::span(frame));
+    const auto mm = units::quantity_cast<millimetres>(m);
+    return mm[count / 2].count();
+  });
+}
@@ -20,6 +20,7 @@
     physical_quantities
 */
 
+#include <units/auto_prefix.h>
 #include <units/physical/si/derived/capacitance.h>
 #include <units/physical/si/derived/resistance.h>
 #include <units/physical/si/base/time.h>
@@ -46,16 +47,7 @@ int main()
 
     std::cout << "at " << t << " voltage is ";
 
-    if (Vt >= 1_q_V)
-      std::cout << Vt;
-    else if (Vt >= 1_q_mV)
-      std::cout << quantity_cast<millivolt>(Vt);
-    else if (Vt >= 1_q_uV)
-      std::cout << quantity_cast<microvolt>(Vt);
-    else if (Vt >= 1_q_nV)
-      std::cout << quantity_cast<nanovolt>(Vt);
-    else
-      std::cout << quantity_cast<picovolt>(Vt);
+    std::cout << units::auto_prefix(Vt);
     std::cout << "\n";
   }
 }
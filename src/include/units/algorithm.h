@@ -0,0 +1,270 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/quantity.h>
+#include <units/quantity_span.h>
+#include <gsl/gsl_assert>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <version>
+
+#if defined(__cpp_lib_execution)
+#include <execution>
+#endif
+
+namespace units {
+
+namespace detail {
+
+template<typename R>
+using range_quantity_t = std::remove_cvref_t<decltype(*std::begin(std::declval<R&>()))>;
+
+template<typename R>
+concept quantity_range_ = // exposition only
+  requires(R& r) {
+    std::begin(r);
+    std::end(r);
+  } &&
+  Quantity<range_quantity_t<R>>;
+
+// a contiguous range of quantities that can be processed as a range of their representation values
+template<typename R>
+concept rep_layout_range_ = // exposition only
+  quantity_range_<R> &&
+  RepLayoutQuantity<range_quantity_t<R>> &&
+  requires(R& r) {
+    { std::data(r) } -> std::convertible_to<const range_quantity_t<R>*>;
+    std::size(r);
+  };
+
+template<typename R>
+[[nodiscard]] auto reps_of(R& r)
+{
+  using span = std::span<std::remove_pointer_t<decltype(std::data(r))>>;
+  return as_reps(span(std::data(r), std::size(r)));
+}
+
+template<typename R, typename Init, typename... Policy>
+[[nodiscard]] auto reduce_impl(const R& r, const Init& init, Policy&&... policy)
+{
+  using Q = range_quantity_t<const R>;
+  using ret = common_quantity_for<std::plus<>, Q, Init>;
+  if constexpr (rep_layout_range_<const R>) {
+    // sum the values in the unit of the range elements and scale the result only once
+    using sum_type = quantity<typename Q::dimension, typename Q::unit, typename ret::rep>;
+    const auto reps = reps_of(r);
+    const sum_type sum(std::reduce(std::forward<Policy>(policy)..., reps.begin(), reps.end(), typename ret::rep{}));
+    return quantity_cast<ret>(sum) + quantity_cast<ret>(init);
+  }
+  else {
+    return std::reduce(std::forward<Policy>(policy)..., std::begin(r), std::end(r), quantity_cast<ret>(init));
+  }
+}
+
+template<typename R1, typename R2, typename Init, typename... Policy>
+[[nodiscard]] auto transform_reduce_impl(const R1& r1, const R2& r2, const Init& init, Policy&&... policy)
+{
+  using Q1 = range_quantity_t<const R1>;
+  using Q2 = range_quantity_t<const R2>;
+  using product = decltype(std::declval<Q1>() * std::declval<Q2>());
+  using ret = common_quantity_for<std::plus<>, product, Init>;
+  if constexpr (rep_layout_range_<const R1> && rep_layout_range_<const R2>) {
+    Expects(std::size(r1) <= std::size(r2));
+    // sum the products in the unit of a single product and scale the result only once
+    using sum_type = quantity<typename product::dimension, typename product::unit, typename ret::rep>;
+    const auto reps1 = reps_of(r1);
+    const auto reps2 = reps_of(r2);
+    const sum_type sum(std::transform_reduce(std::forward<Policy>(policy)..., reps1.begin(), reps1.end(), reps2.begin(),
+                                             typename ret::rep{}));
+    return quantity_cast<ret>(sum) + quantity_cast<ret>(init);
+  }
+  else {
+    return std::transform_reduce(std::forward<Policy>(policy)..., std::begin(r1), std::end(r1), std::begin(r2),
+                                 quantity_cast<ret>(init), std::plus<>(), std::multiplies<>());
+  }
+}
+
+template<typename R, typename Out, typename... Policy>
+auto inclusive_scan_impl(const R& r, Out& out, Policy&&... policy)
+{
+  using Q = range_quantity_t<const R>;
+  if constexpr (rep_layout_range_<const R> && rep_layout_range_<Out> && std::same_as<Q, range_quantity_t<Out>>) {
+    Expects(std::size(r) <= std::size(out));
+    const auto reps = reps_of(r);
+    const auto out_reps = reps_of(out);
+    std::inclusive_scan(std::forward<Policy>(policy)..., reps.begin(), reps.end(), out_reps.begin());
+    return std::next(std::begin(out), static_cast<std::iter_difference_t<decltype(std::begin(out))>>(reps.size()));
+  }
+  else {
+    return std::inclusive_scan(std::forward<Policy>(policy)..., std::begin(r), std::end(r), std::begin(out));
+  }
+}
+
+template<typename R, typename... Policy>
+[[nodiscard]] auto minmax_impl(const R& r, Policy&&... policy)
+{
+  using Q = range_quantity_t<const R>;
+  Expects(std::begin(r) != std::end(r));
+  if constexpr (rep_layout_range_<const R>) {
+    const auto reps = reps_of(r);
+    const auto [min, max] = std::minmax_element(std::forward<Policy>(policy)..., reps.begin(), reps.end());
+    return std::pair<Q, Q>(Q(*min), Q(*max));
+  }
+  else {
+    const auto [min, max] = std::minmax_element(std::forward<Policy>(policy)..., std::begin(r), std::end(r));
+    return std::pair<Q, Q>(*min, *max);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Sums all quantities in a range
+ *
+ * The common quantity type of the elements and @c init is computed at compile time. For contiguous
+ * ranges the values are summed as plain representation values in the unit of the range elements
+ * and the result is scaled to the common unit only once.
+ *
+ * @return the sum of @c init and all elements of @c r
+ */
+template<detail::quantity_range_ R, QuantityEquivalentTo<detail::range_quantity_t<const R>> Init>
+[[nodiscard]] auto reduce(const R& r, const Init& init)
+{
+  return detail::reduce_impl(r, init);
+}
+
+template<detail::quantity_range_ R>
+[[nodiscard]] auto reduce(const R& r)
+{
+  return detail::reduce_impl(r, detail::range_quantity_t<const R>::zero());
+}
+
+/**
+ * @brief Sums products of the corresponding quantities of two ranges
+ *
+ * The dimension and unit of the result are the ones of the products (i.e. forces times displacements
+ * give an energy). For contiguous ranges the products are computed on plain representation values.
+ *
+ * @note @c r2 has to have at least as many elements as @c r1
+ *
+ * @return the sum of @c init and all products of elements of @c r1 and @c r2
+ */
+template<detail::quantity_range_ R1, detail::quantity_range_ R2,
+         QuantityEquivalentTo<decltype(std::declval<detail::range_quantity_t<const R1>>() * std::declval<detail::range_quantity_t<const R2>>())> Init>
+[[nodiscard]] auto transform_reduce(const R1& r1, const R2& r2, const Init& init)
+{
+  return detail::transform_reduce_impl(r1, r2, init);
+}
+
+template<detail::quantity_range_ R1, detail::quantity_range_ R2>
+[[nodiscard]] auto transform_reduce(const R1& r1, const R2& r2)
+{
+  using product = decltype(std::declval<detail::range_quantity_t<const R1>>() * std::declval<detail::range_quantity_t<const R2>>());
+  return detail::transform_reduce_impl(r1, r2, product::zero());
+}
+
+/**
+ * @brief Stores partial sums of quantities in a range in the output range
+ *
+ * For contiguous ranges of the same quantity type the partial sums are computed on plain
+ * representation values.
+ *
+ * @note @c out has to have at least as many elements as @c r
+ *
+ * @return an iterator to the element past the last element written to @c out
+ */
+template<detail::quantity_range_ R, detail::quantity_range_ Out>
+auto inclusive_scan(const R& r, Out&& out)
+{
+  return detail::inclusive_scan_impl(r, out);
+}
+
+/**
+ * @brief Finds the smallest and the largest quantity in a range
+ *
+ * @note @c r has to be non-empty
+ *
+ * @return a pair of the smallest and the largest quantity
+ */
+template<detail::quantity_range_ R>
+[[nodiscard]] auto minmax(const R& r)
+{
+  return detail::minmax_impl(r);
+}
+
+#if defined(__cpp_lib_execution)
+
+template<typename ExecutionPolicy, detail::quantity_range_ R, QuantityEquivalentTo<detail::range_quantity_t<const R>> Init>
+  requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+[[nodiscard]] auto reduce(ExecutionPolicy&& policy, const R& r, const Init& init)
+{
+  return detail::reduce_impl(r, init, std::forward<ExecutionPolicy>(policy));
+}
+
+template<typename ExecutionPolicy, detail::quantity_range_ R>
+  requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+[[nodiscard]] auto reduce(ExecutionPolicy&& policy, const R& r)
+{
+  return detail::reduce_impl(r, detail::range_quantity_t<const R>::zero(), std::forward<ExecutionPolicy>(policy));
+}
+
+template<typename ExecutionPolicy, detail::quantity_range_ R1, detail::quantity_range_ R2,
+         QuantityEquivalentTo<decltype(std::declval<detail::range_quantity_t<const R1>>() * std::declval<detail::range_quantity_t<const R2>>())> Init>
+  requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+[[nodiscard]] auto transform_reduce(ExecutionPolicy&& policy, const R1& r1, const R2& r2, const Init& init)
+{
+  return detail::transform_reduce_impl(r1, r2, init, std::forward<ExecutionPolicy>(policy));
+}
+
+template<typename ExecutionPolicy, detail::quantity_range_ R1, detail::quantity_range_ R2>
+  requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+[[nodiscard]] auto transform_reduce(ExecutionPolicy&& policy, const R1& r1, const R2& r2)
+{
+  using product = decltype(std::declval<detail::range_quantity_t<const R1>>() * std::declval<detail::range_quantity_t<const R2>>());
+  return detail::transform_reduce_impl(r1, r2, product::zero(), std::forward<ExecutionPolicy>(policy));
+}
+
+template<typename ExecutionPolicy, detail::quantity_range_ R, detail::quantity_range_ Out>
+  requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+auto inclusive_scan(ExecutionPolicy&& policy, const R& r, Out&& out)
+{
+  return detail::inclusive_scan_impl(r, out, std::forward<ExecutionPolicy>(policy));
+}
+
+template<typename ExecutionPolicy, detail::quantity_range_ R>
+  requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+[[nodiscard]] auto minmax(ExecutionPolicy&& policy, const R& r)
+{
+  return detail::minmax_impl(r, std::forward<ExecutionPolicy>(policy));
+}
+
+#endif  // __cpp_lib_execution
+
+}  // namespace units
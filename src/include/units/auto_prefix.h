@@ -0,0 +1,220 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/external/downcasting.h>
+#include <units/format.h>
+#include <units/prefix.h>
+#include <units/quantity.h>
+#include <units/quantity_cast.h>
+#include <units/quantity_io.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+namespace units {
+
+/**
+ * @brief A value with a unit prefix selected at runtime by `auto_prefix()`
+ *
+ * Holds the value scaled to the selected prefixed unit together with the standard and ASCII
+ * symbols of that unit (the symbols have a static storage duration).
+ *
+ * @tparam Rep a type to be used to represent the value
+ */
+template<typename Rep>
+class auto_prefixed {
+  Rep value_;
+  std::string_view standard_symbol_;
+  std::string_view ascii_symbol_;
+
+public:
+  using rep = Rep;
+
+  constexpr auto_prefixed(const Rep& v, std::string_view standard_symbol, std::string_view ascii_symbol):
+    value_(v), standard_symbol_(standard_symbol), ascii_symbol_(ascii_symbol)
+  {
+  }
+
+  [[nodiscard]] constexpr Rep count() const noexcept { return value_; }
+  [[nodiscard]] constexpr std::string_view standard_symbol() const noexcept { return standard_symbol_; }
+  [[nodiscard]] constexpr std::string_view ascii_symbol() const noexcept { return ascii_symbol_; }
+
+  template<class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const auto_prefixed& v)
+  {
+    return detail::print_quantity(os, v.count(), v.standard_symbol());
+  }
+};
+
+namespace detail {
+
+// engineering notation prefixes (steps of 10³)
+inline constexpr std::array engineering_prefix_ratios = {
+  ratio(1, 1, -24), ratio(1, 1, -21), ratio(1, 1, -18), ratio(1, 1, -15), ratio(1, 1, -12), ratio(1, 1, -9),
+  ratio(1, 1, -6), ratio(1, 1, -3), ratio(1), ratio(1, 1, 3), ratio(1, 1, 6), ratio(1, 1, 9),
+  ratio(1, 1, 12), ratio(1, 1, 15), ratio(1, 1, 18), ratio(1, 1, 21), ratio(1, 1, 24)};
+
+// binary prefixes (steps of 2¹⁰)
+inline constexpr std::array binary_prefix_ratios = {
+  ratio(1), ratio(1'024), ratio(1'048'576), ratio(1'073'741'824), ratio(1'099'511'627'776),
+  ratio(1'125'899'906'842'624), ratio(1'152'921'504'606'846'976)};
+
+template<PrefixFamily PF, ratio R>
+[[nodiscard]] consteval bool has_prefix()
+{
+  if constexpr(R == ratio(1))
+    return true;
+  else
+    return !std::is_same_v<downcast<prefix_base<PF, R>>, prefix_base<PF, R>>;
+}
+
+template<PrefixFamily PF, const auto& Ratios>
+[[nodiscard]] consteval bool has_any_prefix()
+{
+  return []<std::size_t... I>(std::index_sequence<I...>) {
+    return ((Ratios[I] != ratio(1) && has_prefix<PF, Ratios[I]>()) || ...);
+  }(std::make_index_sequence<Ratios.size()>());
+}
+
+template<typename Dimension, typename U, ratio R>
+inline constexpr auto prefixed_unit_text_v = [] {
+  if constexpr(R == ratio(1))
+    return unit_text<Dimension, U>();
+  else
+    return downcast<prefix_base<typename U::prefix_family, R>>::symbol + unit_text<Dimension, U>();
+}();
+
+template<typename Rep>
+struct prefix_table_entry {
+  Rep factor;
+  std::string_view standard_symbol;
+  std::string_view ascii_symbol;
+};
+
+/**
+ * @brief Compile-time table of the units formed from @c U and the prefixes of its family
+ *
+ * Entries are sorted by the ratio and are equally spaced in the logarithmic scale so the prefix
+ * is selected with a single logarithm and a table lookup. An entry of a prefix not defined for
+ * the family is taken from the closest smaller defined prefix.
+ */
+template<typename Dimension, typename U, typename Rep>
+struct prefix_table {
+  static constexpr bool binary = has_any_prefix<typename U::prefix_family, binary_prefix_ratios>();
+  static constexpr const auto& ratios = []() -> const auto& {
+    if constexpr(binary) return binary_prefix_ratios;
+    else return engineering_prefix_ratios;
+  }();
+  static constexpr std::size_t size = ratios.size();
+  static constexpr std::ptrdiff_t unit_index = std::ranges::find(ratios, ratio(1)) - ratios.begin();
+
+  template<ratio R>
+  static constexpr prefix_table_entry<Rep> make_entry()
+  {
+    constexpr auto& txt = prefixed_unit_text_v<Dimension, U, R>;
+    long double factor = static_cast<long double>(R.num) / static_cast<long double>(R.den);
+    for(auto e = R.exp; e > 0; --e) factor *= 10;
+    for(auto e = R.exp; e < 0; ++e) factor /= 10;
+    return {static_cast<Rep>(factor), std::string_view(txt.standard().c_str(), txt.standard().size()),
+            std::string_view(txt.ascii().c_str(), txt.ascii().size())};
+  }
+
+  static constexpr std::array<prefix_table_entry<Rep>, size> entries = []<std::size_t... I>(std::index_sequence<I...>) {
+    constexpr std::array<bool, size> defined = {has_prefix<typename U::prefix_family, ratios[I]>()...};
+    std::array<prefix_table_entry<Rep>, size> result = {
+      (defined[I] ? make_entry<ratios[I]>() : prefix_table_entry<Rep>{})...};
+    // use the closest smaller prefix (or the closest larger one below the smallest prefix)
+    for(std::size_t i = static_cast<std::size_t>(unit_index) + 1; i < size; ++i)
+      if(!defined[i]) result[i] = result[i - 1];
+    for(std::size_t i = static_cast<std::size_t>(unit_index); i > 0; --i)
+      if(!defined[i - 1]) result[i - 1] = result[i];
+    return result;
+  }(std::make_index_sequence<size>());
+
+  [[nodiscard]] static const prefix_table_entry<Rep>& find(Rep value)
+  {
+    using std::abs, std::isfinite;
+    const Rep v = abs(value);
+    if(!isfinite(v) || v == 0) return entries[static_cast<std::size_t>(unit_index)];
+
+    std::ptrdiff_t step;
+    if constexpr(binary) {
+      using std::ilogb;
+      step = ilogb(v) / 10;
+    }
+    else {
+      using std::log10, std::floor;
+      step = static_cast<std::ptrdiff_t>(floor(floor(log10(v)) / 3));
+    }
+    const auto index = std::clamp<std::ptrdiff_t>(unit_index + step, 0, static_cast<std::ptrdiff_t>(size) - 1);
+    return entries[static_cast<std::size_t>(index)];
+  }
+};
+
+// units prefixed by `auto_prefix()`: the unit itself if it can be prefixed or its coherent unit otherwise
+template<Unit U>
+using auto_prefix_base_unit = conditional<!std::is_same_v<typename U::prefix_family, no_prefix>, U, typename U::reference>;
+
+}  // namespace detail
+
+/**
+ * @brief Expresses a quantity in the unit having the most readable prefix
+ *
+ * Selects a prefix from the prefix family of the unit of the quantity (or of its coherent
+ * unit for the already prefixed units) so that the value is in the [1, 1000) range for the
+ * SI prefixes or in the [1, 1024) range for the binary ones (i.e. 0.0047 V -> 4.7 mV,
+ * 1536 B -> 1.5 KiB). The value never goes below 1 of the smallest and above the largest
+ * prefix available.
+ *
+ * @return the scaled value with the symbol of the selected unit to be printed with
+ *         `operator<<` or `fmt::format()` (supporting all the units-format-spec options)
+ */
+template<typename D, typename U, typename Rep>
+  requires (!std::same_as<typename detail::auto_prefix_base_unit<U>::prefix_family, no_prefix>)
+[[nodiscard]] auto auto_prefix(const quantity<D, U, Rep>& q)
+{
+  using base_unit = detail::auto_prefix_base_unit<U>;
+  using rep = std::conditional_t<treat_as_floating_point<Rep>, Rep, double>;
+  using table = detail::prefix_table<D, base_unit, rep>;
+
+  const rep value = quantity_cast<quantity<D, base_unit, rep>>(q).count();
+  const auto& entry = table::find(value);
+  return auto_prefixed<rep>(value / entry.factor, entry.standard_symbol, entry.ascii_symbol);
+}
+
+}  // namespace units
+
+template<typename Rep, typename CharT>
+struct fmt::formatter<units::auto_prefixed<Rep>, CharT> : units::detail::quantity_formatter<Rep, CharT> {
+  template<typename FormatContext>
+  auto format(const units::auto_prefixed<Rep>& v, FormatContext& ctx) const
+  {
+    return units::detail::quantity_formatter<Rep, CharT>::format(v.count(), v.standard_symbol(), v.ascii_symbol(), ctx);
+  }
+};
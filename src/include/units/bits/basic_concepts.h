@@ -202,6 +202,28 @@ concept UnitOf =
   Dimension<D> &&
   std::same_as<typename U::reference, typename dimension_unit<D>::reference>;
 
+// PointOrigin
+struct zero_origin;
+
+template<typename Reference, Unit U, ratio Offset>
+struct point_origin;
+
+// TODO: Remove when P1985 accepted
+namespace detail {
+
+template<typename Reference, typename U, ratio Offset>
+void to_base_point_origin(const volatile point_origin<Reference, U, Offset>*);
+
+}  // namespace detail
+
+/**
+ * @brief A concept matching all origins of quantity points
+ *
+ * Satisfied by @c zero_origin and all origin types derived from a specialization of @c point_origin.
+ */
+template<typename T>
+concept PointOrigin = std::same_as<T, zero_origin> || requires(T* t) { detail::to_base_point_origin(t); };
+
 // Quantity, QuantityPoint
 namespace detail {
 
@@ -31,7 +31,7 @@ namespace units {
 template<Dimension D, UnitOf<D> U, QuantityValue Rep>
 class quantity;
 
-template<Dimension D, UnitOf<D> U, QuantityValue Rep>
+template<Dimension D, UnitOf<D> U, QuantityValue Rep, PointOrigin Origin>
 class quantity_point;
 
 namespace detail {
@@ -65,8 +65,8 @@ struct common_quantity_impl<quantity<D1, U1, Rep1>, quantity<D2, U2, Rep2>, Rep>
   using type = quantity<dimension, unit, Rep>;
 };
 
-template<typename D, typename U, typename Rep>
-quantity_point<D, U, Rep> common_quantity_point_impl(quantity<D, U, Rep>);
+template<typename Origin, typename D, typename U, typename Rep>
+quantity_point<D, U, Rep, Origin> common_quantity_point_impl(quantity<D, U, Rep>);
 
 }  // namespace detail
 
@@ -74,9 +74,10 @@ template<Quantity Q1, QuantityEquivalentTo<Q1> Q2, QuantityValue Rep = std::comm
 using common_quantity = TYPENAME detail::common_quantity_impl<Q1, Q2, Rep>::type;
 
 template<QuantityPoint QP1, QuantityPoint QP2>
-  requires requires { typename common_quantity<typename QP1::quantity_type, typename QP2::quantity_type>; }
-using common_quantity_point = decltype(
-    detail::common_quantity_point_impl(common_quantity<typename QP1::quantity_type, typename QP2::quantity_type>{}));
+  requires std::same_as<typename QP1::origin, typename QP2::origin> &&
+           requires { typename common_quantity<typename QP1::quantity_type, typename QP2::quantity_type>; }
+using common_quantity_point = decltype(detail::common_quantity_point_impl<typename QP1::origin>(
+    common_quantity<typename QP1::quantity_type, typename QP2::quantity_type>{}));
 
 }  // namespace units
 
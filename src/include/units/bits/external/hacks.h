@@ -36,10 +36,12 @@
 #if COMP_MSVC
 
 #define TYPENAME typename
+#define CONSTEVAL constexpr
 
 #else
 
 #define TYPENAME
+#define CONSTEVAL consteval
 
 #endif
 
@@ -0,0 +1,65 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace units::detail {
+
+inline constexpr std::uint64_t fnv1a_offset_basis = 14695981039346656037ULL;
+inline constexpr std::uint64_t fnv1a_prime = 1099511628211ULL;
+
+/**
+ * @brief 64-bit FNV-1a hash of a string
+ *
+ * Usable at compile time. A different @c basis gives a different (seeded) hash function.
+ */
+[[nodiscard]] constexpr std::uint64_t fnv1a(std::string_view str, std::uint64_t basis = fnv1a_offset_basis) noexcept
+{
+  std::uint64_t hash = basis;
+  for (const char c : str) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= fnv1a_prime;
+  }
+  return hash;
+}
+
+/**
+ * @brief 64-bit FNV-1a hash of an integral value continuing from @c basis
+ *
+ * Bytes of the value are consumed from the least significant one so the result does not
+ * depend on the endianness of the platform.
+ */
+[[nodiscard]] constexpr std::uint64_t fnv1a(std::intmax_t value, std::uint64_t basis = fnv1a_offset_basis) noexcept
+{
+  std::uint64_t hash = basis;
+  auto bits = static_cast<std::uint64_t>(value);
+  for (int i = 0; i < 8; ++i, bits >>= 8) {
+    hash ^= bits & 0xFF;
+    hash *= fnv1a_prime;
+  }
+  return hash;
+}
+
+}  // namespace units::detail
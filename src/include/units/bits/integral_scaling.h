@@ -0,0 +1,251 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <gsl/gsl_assert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+namespace units::detail {
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+// high 64 bits of the 128-bit product of two 64-bit unsigned integers
+[[nodiscard]] constexpr std::uint64_t umulh(std::uint64_t a, std::uint64_t b) noexcept
+{
+#ifdef __SIZEOF_INT128__
+  return static_cast<std::uint64_t>((static_cast<uint128_t>(a) * b) >> 64);
+#else
+  const std::uint64_t a_lo = a & 0xFFFF'FFFF;
+  const std::uint64_t a_hi = a >> 32;
+  const std::uint64_t b_lo = b & 0xFFFF'FFFF;
+  const std::uint64_t b_hi = b >> 32;
+  const std::uint64_t lo_lo = a_lo * b_lo;
+  const std::uint64_t hi_lo = a_hi * b_lo;
+  const std::uint64_t lo_hi = a_lo * b_hi;
+  const std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFF'FFFF) + lo_hi;
+  return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+/* a reciprocal of an invariant divisor `d` such that `n / d == umulh(n, multiplier) >> (shift - 1)` for every
+ `n <= 2^63` (T. Granlund, P. L. Montgomery, "Division by Invariant Integers using Multiplication", 1994)
+
+ for powers of 2 `multiplier` is 0 and `n / d == n >> shift`
+ */
+struct reciprocal {
+  std::uint64_t multiplier;
+  unsigned shift;
+};
+
+[[nodiscard]] constexpr reciprocal make_reciprocal(std::uint64_t d) noexcept
+{
+  Expects(d > 0 && d <= std::uint64_t(1) << 63);
+
+  // l = ceil(log2(d))
+  unsigned l = 0;
+  while ((std::uint64_t(1) << l) < d) ++l;
+  if ((std::uint64_t(1) << l) == d) {
+    return {.multiplier = 0, .shift = l};
+  }
+
+  // multiplier = ceil(2^(63 + l) / d) computed with a bit-by-bit long division of 2^(l - 1) * 2^64 by d;
+  // as 2^(l - 1) < d < 2^l the result always fits in 64 bits
+  std::uint64_t q = 0;
+  std::uint64_t r = std::uint64_t(1) << (l - 1);
+  for (int i = 0; i < 64; ++i) {
+    r <<= 1;
+    q <<= 1;
+    if (r >= d) {
+      r -= d;
+      q |= 1;
+    }
+  }
+  return {.multiplier = q + (r != 0 ? 1 : 0), .shift = l};
+}
+
+[[nodiscard]] constexpr std::uint64_t divide(std::uint64_t n, reciprocal rec) noexcept
+{
+  if (rec.multiplier == 0) {
+    return n >> rec.shift;
+  }
+  return umulh(n, rec.multiplier) >> (rec.shift - 1);
+}
+
+/* a reciprocal of an invariant divisor `d` normalized to have its highest bit set (`d << shift`) used to divide
+ a 128-bit dividend by `d` with multiplications only (N. Möller, T. Granlund, "Improved division by invariant
+ integers", 2011)
+
+ `multiplier` is `floor((2^128 - 1) / (d << shift)) - 2^64`
+ */
+struct wide_reciprocal {
+  std::uint64_t divisor;
+  std::uint64_t multiplier;
+  unsigned shift;
+};
+
+[[nodiscard]] constexpr wide_reciprocal make_wide_reciprocal(std::uint64_t d) noexcept
+{
+  Expects(d > 0);
+
+  unsigned shift = 0;
+  while ((d << shift) < (std::uint64_t(1) << 63)) ++shift;
+  const std::uint64_t dn = d << shift;
+
+  // the quotient of (2^64 - 1 - dn) * 2^64 + (2^64 - 1) by dn computed with a bit-by-bit long division;
+  // as 2^64 - 1 - dn < dn the result always fits in 64 bits
+  std::uint64_t q = 0;
+  std::uint64_t r = ~dn;
+  for (int i = 0; i < 64; ++i) {
+    const bool carry = (r >> 63) != 0;
+    r = (r << 1) | 1;
+    q <<= 1;
+    if (carry || r >= dn) {
+      r -= dn;
+      q |= 1;
+    }
+  }
+  return {.divisor = dn, .multiplier = q, .shift = shift};
+}
+
+// the quotient of `hi * 2^64 + lo` by the divisor of `rec` (`hi` has to be less than that divisor)
+[[nodiscard]] constexpr std::uint64_t divide(std::uint64_t hi, std::uint64_t lo, wide_reciprocal rec) noexcept
+{
+  const std::uint64_t u1 = rec.shift == 0 ? hi : (hi << rec.shift) | (lo >> (64 - rec.shift));
+  const std::uint64_t u0 = lo << rec.shift;
+
+  // (q1, q0) = multiplier * u1 + (u1 + 1) * 2^64 + u0
+  std::uint64_t q0 = rec.multiplier * u1;
+  std::uint64_t q1 = umulh(rec.multiplier, u1) + u1 + 1;
+  q0 += u0;
+  if (q0 < u0) ++q1;
+
+  std::uint64_t r = u0 - q1 * rec.divisor;
+  if (r > q0) {
+    --q1;
+    r += rec.divisor;
+  }
+  if (r >= rec.divisor) ++q1;
+  return q1;
+}
+
+/* scales `v` by `Multiplier / Divisor` truncating the result toward zero
+
+ Intermediate values are computed on magnitudes in 64-bit unsigned arithmetic and the division by the compile-time
+ `Divisor` is done with a multiplication by its reciprocal. The way the product is formed is selected at compile time:
+ - if `Multiplier` times any value of `From` fits in 63 bits a plain product is divided,
+ - otherwise `v` is split into `a * Divisor + b` and only `a * Multiplier + b * Multiplier / Divisor` is computed, so
+   the intermediate results never overflow as long as the final one fits in `T`,
+ - if even `b * Multiplier` could overflow a 128-bit product is formed from its high and low 64-bit halves and
+   divided by the reciprocal of `Divisor` normalized for a division of a 128-bit dividend.
+ */
+template<std::intmax_t Multiplier, std::intmax_t Divisor, typename From, std::signed_integral T>
+  requires (Multiplier > 0) && (Divisor > 0) && (std::numeric_limits<T>::digits <= 63)
+[[nodiscard]] constexpr T scale_integral(T v) noexcept
+{
+  using uint = std::uint64_t;
+  constexpr uint m = static_cast<uint>(Multiplier);
+  constexpr uint d = static_cast<uint>(Divisor);
+  constexpr uint max_magnitude = uint(1) << 63;
+  constexpr uint from_max_magnitude = [] {
+    if constexpr (std::integral<From> && std::numeric_limits<From>::digits <= 63) {
+      return static_cast<uint>(std::numeric_limits<From>::max()) + (std::signed_integral<From> ? 1 : 0);
+    }
+    else {
+      return max_magnitude;
+    }
+  }();
+
+  // branch-free magnitude and sign (all ones for negative values)
+  const uint sign = uint(0) - static_cast<uint>(v < 0);
+  const uint n = (static_cast<uint>(v) ^ sign) - sign;
+  uint result;
+
+  if constexpr (d == 1) {
+    result = n * m;
+  }
+  else if constexpr (from_max_magnitude <= max_magnitude / m && from_max_magnitude * m < d) {
+    // the result is always truncated to zero
+    return T(0);
+  }
+  else {
+    constexpr reciprocal rec = make_reciprocal(d);
+    if constexpr (m == 1) {
+      result = divide(n, rec);
+    }
+    else if constexpr (from_max_magnitude <= max_magnitude / m) {
+      result = divide(n * m, rec);
+    }
+    else if constexpr ((d - 1) <= max_magnitude / m) {
+      const uint a = divide(n, rec);
+      const uint b = n - a * d;
+      result = a * m + divide(b * m, rec);
+    }
+    else {
+      constexpr wide_reciprocal wide_rec = make_wide_reciprocal(d);
+      result = divide(umulh(n, m), n * m, wide_rec);
+    }
+  }
+
+  return static_cast<T>((result ^ sign) - sign);
+}
+
+// a scaling factor `multiplier / divisor` known only at runtime with the reciprocal of its divisor computed once
+struct runtime_scale {
+  std::uint64_t multiplier;
+  wide_reciprocal rec;
+};
+
+[[nodiscard]] constexpr runtime_scale make_runtime_scale(std::uint64_t multiplier, std::uint64_t divisor) noexcept
+{
+  Expects(multiplier > 0);
+  return {.multiplier = multiplier, .rec = make_wide_reciprocal(divisor)};
+}
+
+/* scales `v` by a runtime factor truncating the result toward zero
+
+ The full 128-bit product of the magnitude of `v` and the multiplier is divided by the reciprocal of the divisor so
+ the result is exact as long as it fits in `T`.
+ */
+template<std::integral T>
+  requires (std::numeric_limits<T>::digits <= 64)
+[[nodiscard]] constexpr T scale_integral(T v, const runtime_scale& s) noexcept
+{
+  using uint = std::uint64_t;
+  if constexpr (std::signed_integral<T>) {
+    const uint sign = uint(0) - static_cast<uint>(v < 0);
+    const uint n = (static_cast<uint>(v) ^ sign) - sign;
+    const uint result = divide(umulh(n, s.multiplier), n * s.multiplier, s.rec);
+    return static_cast<T>((result ^ sign) - sign);
+  }
+  else {
+    const uint n = v;
+    return static_cast<T>(divide(umulh(n, s.multiplier), n * s.multiplier, s.rec));
+  }
+}
+
+}  // namespace units::detail
@@ -0,0 +1,316 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/bits/registry_units.h>
+#include <units/data/data.h>
+#include <units/physical/si/cgs/cgs.h>
+#include <units/physical/si/fps/fps.h>
+#include <units/physical/si/iau/iau.h>
+#include <units/physical/si/si.h>
+#include <units/physical/si/typographic/typographic.h>
+#include <units/physical/si/us/us.h>
+#include <concepts>
+
+namespace units::detail {
+
+// all the units of `units::physical::si` (including the systems based on it) and `units::data`
+// - `si::international` and `si::imperial` are not included as they redefine the units of `si::fps`
+// - `si::femtotonne` is not included as its symbol is the same as the one of a foot
+// - `si::degree_celsius` and `si::us::degree_fahrenheit` are not included as their values are
+//   measured from non-zero origins and a `dynamic_quantity` can hold only the values measured
+//   from the zero of the scale (i.e. "20 °C" would be silently read as 20 K)
+using registered_units = registry_groups<
+  registry_units<physical::si::dim_amount_of_substance,
+    physical::si::mole>,
+  registry_units<physical::si::dim_electric_current,
+    physical::si::ampere, physical::si::yoctoampere, physical::si::zeptoampere, physical::si::attoampere,
+    physical::si::femtoampere, physical::si::picoampere, physical::si::nanoampere, physical::si::microampere,
+    physical::si::milliampere, physical::si::centiampere, physical::si::deciampere, physical::si::decaampere,
+    physical::si::hectoampere, physical::si::kiloampere, physical::si::megaampere, physical::si::gigaampere,
+    physical::si::teraampere, physical::si::petaampere, physical::si::exaampere, physical::si::zettaampere,
+    physical::si::yottaampere>,
+  registry_units<physical::si::dim_length,
+    physical::si::metre, physical::si::yoctometre, physical::si::zeptometre, physical::si::attometre,
+    physical::si::femtometre, physical::si::picometre, physical::si::nanometre, physical::si::micrometre,
+    physical::si::millimetre, physical::si::centimetre, physical::si::decimetre, physical::si::decametre,
+    physical::si::hectometre, physical::si::kilometre, physical::si::megametre, physical::si::gigametre,
+    physical::si::terametre, physical::si::petametre, physical::si::exametre, physical::si::zettametre,
+    physical::si::yottametre, physical::si::astronomical_unit, physical::si::iau::light_year,
+    physical::si::iau::parsec, physical::si::iau::angstrom, physical::si::typographic::pica_comp,
+    physical::si::typographic::pica_prn, physical::si::typographic::point_comp,
+    physical::si::typographic::point_prn, physical::si::us::foot, physical::si::us::fathom, physical::si::us::mile>,
+  registry_units<physical::si::dim_luminous_intensity,
+    physical::si::candela, physical::si::yoctocandela, physical::si::zeptocandela, physical::si::attocandela,
+    physical::si::femtocandela, physical::si::picocandela, physical::si::nanocandela, physical::si::microcandela,
+    physical::si::millicandela, physical::si::centicandela, physical::si::decicandela, physical::si::decacandela,
+    physical::si::hectocandela, physical::si::kilocandela, physical::si::megacandela, physical::si::gigacandela,
+    physical::si::teracandela, physical::si::petacandela, physical::si::exacandela, physical::si::zettacandela,
+    physical::si::yottacandela>,
+  registry_units<physical::si::dim_mass,
+    physical::si::gram, physical::si::yoctogram, physical::si::zeptogram, physical::si::attogram,
+    physical::si::femtogram, physical::si::picogram, physical::si::nanogram, physical::si::microgram,
+    physical::si::milligram, physical::si::centigram, physical::si::decigram, physical::si::decagram,
+    physical::si::hectogram, physical::si::kilogram, physical::si::megagram, physical::si::gigagram,
+    physical::si::teragram, physical::si::petagram, physical::si::exagram, physical::si::zettagram,
+    physical::si::yottagram, physical::si::tonne, physical::si::yoctotonne, physical::si::zeptotonne,
+    physical::si::attotonne, physical::si::picotonne, physical::si::nanotonne, physical::si::microtonne,
+    physical::si::millitonne, physical::si::centitonne, physical::si::decitonne, physical::si::decatonne,
+    physical::si::hectotonne, physical::si::kilotonne, physical::si::megatonne, physical::si::gigatonne,
+    physical::si::teratonne, physical::si::petatonne, physical::si::exatonne, physical::si::zettatonne,
+    physical::si::yottatonne, physical::si::dalton>,
+  registry_units<physical::si::dim_thermodynamic_temperature,
+    physical::si::kelvin>,
+  registry_units<physical::si::dim_time,
+    physical::si::second, physical::si::yoctosecond, physical::si::zeptosecond, physical::si::attosecond,
+    physical::si::femtosecond, physical::si::picosecond, physical::si::nanosecond, physical::si::microsecond,
+    physical::si::millisecond, physical::si::minute, physical::si::hour, physical::si::day>,
+  registry_units<physical::si::cgs::dim_acceleration,
+    physical::si::cgs::gal>,
+  registry_units<physical::si::cgs::dim_energy,
+    physical::si::cgs::erg>,
+  registry_units<physical::si::cgs::dim_force,
+    physical::si::cgs::dyne>,
+  registry_units<physical::si::cgs::dim_power,
+    physical::si::cgs::erg_per_second>,
+  registry_units<physical::si::cgs::dim_pressure,
+    physical::si::cgs::barye>,
+  registry_units<physical::si::cgs::dim_speed,
+    physical::si::cgs::centimetre_per_second>,
+  registry_units<physical::si::dim_absorbed_dose,
+    physical::si::gray, physical::si::yoctogray, physical::si::zeptogray, physical::si::attogray,
+    physical::si::femtogray, physical::si::picogray, physical::si::nanogray, physical::si::microgray,
+    physical::si::milligray, physical::si::centigray, physical::si::decigray, physical::si::decagray,
+    physical::si::hectogray, physical::si::kilogray, physical::si::megagray, physical::si::gigagray,
+    physical::si::teragray, physical::si::petagray, physical::si::exagray, physical::si::zettagray,
+    physical::si::yottagray>,
+  registry_units<physical::si::dim_acceleration,
+    physical::si::metre_per_second_sq>,
+  registry_units<physical::si::dim_angular_velocity,
+    physical::si::radian_per_second>,
+  registry_units<physical::si::dim_area,
+    physical::si::square_metre, physical::si::square_yoctometre, physical::si::square_zeptometre,
+    physical::si::square_attometre, physical::si::square_femtometre, physical::si::square_picometre,
+    physical::si::square_nanometre, physical::si::square_micrometre, physical::si::square_millimetre,
+    physical::si::square_centimetre, physical::si::square_decimetre, physical::si::square_decametre,
+    physical::si::square_hectometre, physical::si::square_kilometre, physical::si::square_megametre,
+    physical::si::square_gigametre, physical::si::square_terametre, physical::si::square_petametre,
+    physical::si::square_exametre, physical::si::square_zettametre, physical::si::square_yottametre,
+    physical::si::hectare>,
+  registry_units<physical::si::dim_capacitance,
+    physical::si::farad, physical::si::yoctofarad, physical::si::zeptofarad, physical::si::attofarad,
+    physical::si::femtofarad, physical::si::picofarad, physical::si::nanofarad, physical::si::microfarad,
+    physical::si::millifarad, physical::si::centifarad, physical::si::decifarad, physical::si::decafarad,
+    physical::si::hectofarad, physical::si::kilofarad, physical::si::megafarad, physical::si::gigafarad,
+    physical::si::terafarad, physical::si::petafarad, physical::si::exafarad, physical::si::zettafarad,
+    physical::si::yottafarad>,
+  registry_units<physical::si::dim_catalytic_activity,
+    physical::si::katal, physical::si::yoctokatal, physical::si::zeptokatal, physical::si::attokatal,
+    physical::si::femtokatal, physical::si::picokatal, physical::si::nanokatal, physical::si::microkatal,
+    physical::si::millikatal, physical::si::centikatal, physical::si::decikatal, physical::si::decakatal,
+    physical::si::hectokatal, physical::si::kilokatal, physical::si::megakatal, physical::si::gigakatal,
+    physical::si::terakatal, physical::si::petakatal, physical::si::exakatal, physical::si::zettakatal,
+    physical::si::yottakatal, physical::si::enzyme_unit>,
+  registry_units<physical::si::dim_charge_density,
+    physical::si::coulomb_per_metre_cub>,
+  registry_units<physical::si::dim_surface_charge_density,
+    physical::si::coulomb_per_metre_sq>,
+  registry_units<physical::si::dim_concentration,
+    physical::si::mol_per_metre_cub>,
+  registry_units<physical::si::dim_conductance,
+    physical::si::siemens, physical::si::yoctosiemens, physical::si::zeptosiemens, physical::si::attosiemens,
+    physical::si::femtosiemens, physical::si::picosiemens, physical::si::nanosiemens, physical::si::microsiemens,
+    physical::si::millisiemens, physical::si::kilosiemens, physical::si::megasiemens, physical::si::gigasiemens,
+    physical::si::terasiemens, physical::si::petasiemens, physical::si::exasiemens, physical::si::zettasiemens,
+    physical::si::yottasiemens>,
+  registry_units<physical::si::dim_current_density,
+    physical::si::ampere_per_metre_sq>,
+  registry_units<physical::si::dim_density,
+    physical::si::kilogram_per_metre_cub>,
+  registry_units<physical::si::dim_dynamic_viscosity,
+    physical::si::pascal_second>,
+  registry_units<physical::si::dim_electric_charge,
+    physical::si::coulomb>,
+  registry_units<physical::si::dim_electric_field_strength,
+    physical::si::volt_per_metre>,
+  registry_units<physical::si::dim_energy,
+    physical::si::joule, physical::si::yoctojoule, physical::si::zeptojoule, physical::si::attojoule,
+    physical::si::femtojoule, physical::si::picojoule, physical::si::nanojoule, physical::si::microjoule,
+    physical::si::millijoule, physical::si::kilojoule, physical::si::megajoule, physical::si::gigajoule,
+    physical::si::terajoule, physical::si::petajoule, physical::si::exajoule, physical::si::zettajoule,
+    physical::si::yottajoule, physical::si::electronvolt, physical::si::gigaelectronvolt>,
+  registry_units<physical::si::dim_force,
+    physical::si::newton, physical::si::yoctonewton, physical::si::zeptonewton, physical::si::attonewton,
+    physical::si::femtonewton, physical::si::piconewton, physical::si::nanonewton, physical::si::micronewton,
+    physical::si::millinewton, physical::si::centinewton, physical::si::decinewton, physical::si::decanewton,
+    physical::si::hectonewton, physical::si::kilonewton, physical::si::meganewton, physical::si::giganewton,
+    physical::si::teranewton, physical::si::petanewton, physical::si::exanewton, physical::si::zettanewton,
+    physical::si::yottanewton>,
+  registry_units<physical::si::dim_frequency,
+    physical::si::hertz, physical::si::yoctohertz, physical::si::zeptohertz, physical::si::attohertz,
+    physical::si::femtohertz, physical::si::picohertz, physical::si::nanohertz, physical::si::microhertz,
+    physical::si::millihertz, physical::si::kilohertz, physical::si::megahertz, physical::si::gigahertz,
+    physical::si::terahertz, physical::si::petahertz, physical::si::exahertz, physical::si::zettahertz,
+    physical::si::yottahertz>,
+  registry_units<physical::si::dim_heat_capacity,
+    physical::si::joule_per_kelvin>,
+  registry_units<physical::si::dim_specific_heat_capacity,
+    physical::si::joule_per_kilogram_kelvin>,
+  registry_units<physical::si::dim_molar_heat_capacity,
+    physical::si::joule_per_mole_kelvin>,
+  registry_units<physical::si::dim_inductance,
+    physical::si::henry, physical::si::yoctohenry, physical::si::zeptohenry, physical::si::attohenry,
+    physical::si::femtohenry, physical::si::picohenry, physical::si::nanohenry, physical::si::microhenry,
+    physical::si::millihenry, physical::si::kilohenry, physical::si::megahenry, physical::si::gigahenry,
+    physical::si::terahenry, physical::si::petahenry, physical::si::exahenry, physical::si::zettahenry,
+    physical::si::yottahenry>,
+  registry_units<physical::si::dim_luminance,
+    physical::si::candela_per_metre_sq>,
+  registry_units<physical::si::dim_magnetic_flux,
+    physical::si::weber, physical::si::yoctoweber, physical::si::zeptoweber, physical::si::attoweber,
+    physical::si::femtoweber, physical::si::picoweber, physical::si::nanoweber, physical::si::microweber,
+    physical::si::milliweber, physical::si::kiloweber, physical::si::megaweber, physical::si::gigaweber,
+    physical::si::teraweber, physical::si::petaweber, physical::si::exaweber, physical::si::zettaweber,
+    physical::si::yottaweber>,
+  registry_units<physical::si::dim_magnetic_induction,
+    physical::si::tesla, physical::si::yoctotesla, physical::si::zeptotesla, physical::si::attotesla,
+    physical::si::femtotesla, physical::si::picotesla, physical::si::nanotesla, physical::si::microtesla,
+    physical::si::millitesla, physical::si::kilotesla, physical::si::megatesla, physical::si::gigatesla,
+    physical::si::teratesla, physical::si::petatesla, physical::si::exatesla, physical::si::zettatesla,
+    physical::si::yottatesla, physical::si::gauss>,
+  registry_units<physical::si::dim_molar_energy,
+    physical::si::joule_per_mole>,
+  registry_units<physical::si::dim_momentum,
+    physical::si::kilogram_metre_per_second>,
+  registry_units<physical::si::dim_permeability,
+    physical::si::henry_per_metre>,
+  registry_units<physical::si::dim_permittivity,
+    physical::si::farad_per_metre>,
+  registry_units<physical::si::dim_power,
+    physical::si::watt, physical::si::yoctowatt, physical::si::zeptowatt, physical::si::attowatt,
+    physical::si::femtowatt, physical::si::picowatt, physical::si::nanowatt, physical::si::microwatt,
+    physical::si::milliwatt, physical::si::kilowatt, physical::si::megawatt, physical::si::gigawatt,
+    physical::si::terawatt, physical::si::petawatt, physical::si::exawatt, physical::si::zettawatt,
+    physical::si::yottawatt>,
+  registry_units<physical::si::dim_pressure,
+    physical::si::pascal, physical::si::yoctopascal, physical::si::zeptopascal, physical::si::attopascal,
+    physical::si::femtopascal, physical::si::picopascal, physical::si::nanopascal, physical::si::micropascal,
+    physical::si::millipascal, physical::si::centipascal, physical::si::decipascal, physical::si::decapascal,
+    physical::si::hectopascal, physical::si::kilopascal, physical::si::megapascal, physical::si::gigapascal,
+    physical::si::terapascal, physical::si::petapascal, physical::si::exapascal, physical::si::zettapascal,
+    physical::si::yottapascal>,
+  registry_units<physical::si::dim_resistance,
+    physical::si::ohm, physical::si::yoctoohm, physical::si::zeptoohm, physical::si::attoohm,
+    physical::si::femtoohm, physical::si::picoohm, physical::si::nanoohm, physical::si::microohm,
+    physical::si::milliohm, physical::si::kiloohm, physical::si::megaohm, physical::si::gigaohm,
+    physical::si::teraohm, physical::si::petaohm, physical::si::exaohm, physical::si::zettaohm,
+    physical::si::yottaohm>,
+  registry_units<physical::si::dim_speed,
+    physical::si::metre_per_second, physical::si::kilometre_per_hour>,
+  registry_units<physical::si::dim_surface_tension,
+    physical::si::newton_per_metre>,
+  registry_units<physical::si::dim_thermal_conductivity,
+    physical::si::watt_per_metre_kelvin>,
+  registry_units<physical::si::dim_torque,
+    physical::si::newton_metre>,
+  registry_units<physical::si::dim_voltage,
+    physical::si::volt, physical::si::yoctovolt, physical::si::zeptovolt, physical::si::attovolt,
+    physical::si::femtovolt, physical::si::picovolt, physical::si::nanovolt, physical::si::microvolt,
+    physical::si::millivolt, physical::si::centivolt, physical::si::decivolt, physical::si::decavolt,
+    physical::si::hectovolt, physical::si::kilovolt, physical::si::megavolt, physical::si::gigavolt,
+    physical::si::teravolt, physical::si::petavolt, physical::si::exavolt, physical::si::zettavolt,
+    physical::si::yottavolt>,
+  registry_units<physical::si::dim_volume,
+    physical::si::cubic_metre, physical::si::cubic_yoctometre, physical::si::cubic_zeptometre,
+    physical::si::cubic_attometre, physical::si::cubic_femtometre, physical::si::cubic_picometre,
+    physical::si::cubic_nanometre, physical::si::cubic_micrometre, physical::si::cubic_millimetre,
+    physical::si::cubic_centimetre, physical::si::cubic_decimetre, physical::si::cubic_decametre,
+    physical::si::cubic_hectometre, physical::si::cubic_kilometre, physical::si::cubic_megametre,
+    physical::si::cubic_gigametre, physical::si::cubic_terametre, physical::si::cubic_petametre,
+    physical::si::cubic_exametre, physical::si::cubic_zettametre, physical::si::cubic_yottametre,
+    physical::si::litre, physical::si::yoctolitre, physical::si::zeptolitre, physical::si::attolitre,
+    physical::si::femtolitre, physical::si::picolitre, physical::si::nanolitre, physical::si::microlitre,
+    physical::si::millilitre, physical::si::centilitre, physical::si::decilitre, physical::si::decalitre,
+    physical::si::hectolitre, physical::si::kilolitre, physical::si::megalitre, physical::si::gigalitre,
+    physical::si::teralitre, physical::si::petalitre, physical::si::exalitre, physical::si::zettalitre,
+    physical::si::yottalitre>,
+  registry_units<physical::si::fps::dim_length,
+    physical::si::fps::foot, physical::si::fps::inch, physical::si::fps::thousandth, physical::si::fps::thou,
+    physical::si::fps::mil, physical::si::fps::yard, physical::si::fps::fathom, physical::si::fps::kiloyard,
+    physical::si::fps::mile, physical::si::fps::nautical_mile>,
+  registry_units<physical::si::fps::dim_mass,
+    physical::si::fps::pound, physical::si::fps::grain, physical::si::fps::dram, physical::si::fps::ounce,
+    physical::si::fps::stone, physical::si::fps::quarter, physical::si::fps::hundredweight,
+    physical::si::fps::short_ton, physical::si::fps::long_ton>,
+  registry_units<physical::si::fps::dim_acceleration,
+    physical::si::fps::foot_per_second_sq>,
+  registry_units<physical::si::fps::dim_area,
+    physical::si::fps::square_foot>,
+  registry_units<physical::si::fps::dim_density,
+    physical::si::fps::pound_per_foot_cub>,
+  registry_units<physical::si::fps::dim_energy,
+    physical::si::fps::foot_poundal, physical::si::fps::foot_pound_force>,
+  registry_units<physical::si::fps::dim_force,
+    physical::si::fps::poundal, physical::si::fps::pound_force, physical::si::fps::kilopound_force,
+    physical::si::fps::kip>,
+  registry_units<physical::si::fps::dim_power,
+    physical::si::fps::foot_poundal_per_second, physical::si::fps::foot_pound_force_per_second,
+    physical::si::fps::horse_power>,
+  registry_units<physical::si::fps::dim_pressure,
+    physical::si::fps::poundal_per_foot_sq, physical::si::fps::pound_force_per_foot_sq,
+    physical::si::fps::pound_force_per_inch_sq, physical::si::fps::kilopound_force_per_inch_sq>,
+  registry_units<physical::si::fps::dim_speed,
+    physical::si::fps::foot_per_second, physical::si::fps::mile_per_hour, physical::si::fps::nautical_mile_per_hour,
+    physical::si::fps::knot>,
+  registry_units<physical::si::fps::dim_volume,
+    physical::si::fps::cubic_foot, physical::si::fps::cubic_yard>,
+  registry_units<data::dim_information,
+    data::bit, data::kibibit, data::mebibit, data::gibibit, data::tebibit, data::pebibit, data::byte,
+    data::kibibyte, data::mebibyte, data::gibibyte, data::tebibyte, data::pebibyte>,
+  registry_units<data::dim_bitrate,
+    data::bit_per_second, data::kibibit_per_second, data::mebibit_per_second, data::gibibit_per_second,
+    data::tebibit_per_second, data::pebibit_per_second>>;
+
+// the units registered for the dimension D (as `registry_units<D, Us...>`)
+template<typename D, typename Group>
+struct registered_units_of_group {
+  using type = registry_units<D>;
+};
+
+template<typename D, typename... Us>
+struct registered_units_of_group<D, registry_units<D, Us...>> {
+  using type = registry_units<D, Us...>;
+};
+
+template<typename D, typename Groups>
+struct registered_units_of_impl;
+
+template<typename D, typename... Groups>
+struct registered_units_of_impl<D, registry_groups<Groups...>> :
+    registry_units_join<D, registry_units<D>, typename registered_units_of_group<D, Groups>::type...> {};
+
+template<Dimension D>
+using registered_units_of = TYPENAME registered_units_of_impl<D, registered_units>::type;
+
+}  // namespace units::detail
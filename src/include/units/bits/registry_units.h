@@ -0,0 +1,52 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/concepts.h>
+#include <cstddef>
+
+namespace units::detail {
+
+// a list of units of the dimension D
+template<Dimension D, UnitOf<D>... Us>
+struct registry_units {
+  static constexpr std::size_t size = sizeof...(Us);
+};
+
+template<typename... Groups>
+struct registry_groups {};
+
+template<typename D, typename... Lists>
+struct registry_units_join;
+
+template<typename D, typename... Us>
+struct registry_units_join<D, registry_units<D, Us...>> {
+  using type = registry_units<D, Us...>;
+};
+
+template<typename D, typename... Us1, typename... Us2, typename... Rest>
+struct registry_units_join<D, registry_units<D, Us1...>, registry_units<D, Us2...>, Rest...> :
+    registry_units_join<D, registry_units<D, Us1..., Us2...>, Rest...> {};
+
+}  // namespace units::detail
@@ -177,4 +177,8 @@ constexpr auto unit_text()
   }
 }
 
+// symbol of a unit with a static storage duration
+template<Dimension Dim, Unit U>
+inline constexpr auto unit_text_v = unit_text<Dim, U>();
+
 }  // namespace units::detail
@@ -0,0 +1,443 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/quantity_cast.h>
+#include <units/quantity_point.h>
+#include <units/quantity_span.h>
+#include <gsl/gsl_assert>
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace units {
+
+namespace detail {
+
+template<typename T>
+concept compressible_rep =
+  (std::integral<T> && sizeof(T) <= sizeof(std::uint64_t)) || std::same_as<T, float> || std::same_as<T, double>;
+
+template<typename T>
+concept compressible_element = (Quantity<T> || QuantityPoint<T>) && compressible_rep<typename T::rep>;
+
+template<typename T>
+struct element_quantity {
+  using type = T;
+};
+
+template<QuantityPoint T>
+struct element_quantity<T> {
+  using type = TYPENAME T::quantity_type;
+};
+
+template<typename T>
+[[nodiscard]] constexpr auto rep_of(const T& v)
+{
+  if constexpr (QuantityPoint<T>)
+    return v.relative().count();
+  else
+    return v.count();
+}
+
+[[nodiscard]] constexpr std::uint64_t zigzag_encode(std::int64_t v) noexcept
+{
+  return (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63);
+}
+
+[[nodiscard]] constexpr std::int64_t zigzag_decode(std::uint64_t v) noexcept
+{
+  return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+}
+
+// delta-of-delta of integral values written as zig-zag LEB128 varints (a constant rate of change,
+// i.e. regular timestamps, takes a single byte per value)
+struct delta_of_delta_codec {
+  class encoder {
+    std::uint64_t prev_ = 0;
+    std::uint64_t delta_ = 0;
+
+  public:
+    void start(std::uint64_t first, std::vector<std::byte>&) noexcept
+    {
+      prev_ = first;
+      delta_ = 0;
+    }
+
+    void put(std::uint64_t v, std::vector<std::byte>& out)
+    {
+      // the arithmetic is modulo 2^64 so it never overflows
+      const std::uint64_t delta = v - prev_;
+      std::uint64_t bits = zigzag_encode(static_cast<std::int64_t>(delta - delta_));
+      for (; bits >= 0x80; bits >>= 7) out.push_back(static_cast<std::byte>(bits | 0x80));
+      out.push_back(static_cast<std::byte>(bits));
+      prev_ = v;
+      delta_ = delta;
+    }
+  };
+
+  class decoder {
+    const std::byte* pos_;
+    std::uint64_t prev_;
+    std::uint64_t delta_ = 0;
+
+  public:
+    decoder(const std::byte* pos, std::uint64_t first) noexcept : pos_(pos), prev_(first) {}
+
+    [[nodiscard]] std::uint64_t next() noexcept
+    {
+      std::uint64_t bits = 0;
+      for (unsigned shift = 0;; shift += 7) {
+        const auto b = std::to_integer<std::uint64_t>(*pos_++);
+        bits |= (b & 0x7f) << shift;
+        if (b < 0x80) break;
+      }
+      delta_ += static_cast<std::uint64_t>(zigzag_decode(bits));
+      prev_ += delta_;
+      return prev_;
+    }
+  };
+};
+
+// XOR of bit patterns of consecutive floating-point values with the meaningful bits only (as in
+// the Gorilla time series database); an unchanged value takes a single bit
+template<unsigned Bits>
+struct xor_codec {
+  class encoder {
+    unsigned free_ = 0;  // unused bits in the last byte
+    std::uint64_t prev_ = 0;
+    unsigned leading_ = Bits + 1;  // no window yet
+    unsigned trailing_ = 0;
+
+    void write(std::vector<std::byte>& out, std::uint64_t v, unsigned n)
+    {
+      while (n > 0) {
+        if (free_ == 0) {
+          out.push_back(std::byte{0});
+          free_ = 8;
+        }
+        const unsigned k = std::min(n, free_);
+        const auto chunk = static_cast<unsigned>(v >> (n - k)) & ((1u << k) - 1);
+        out.back() |= static_cast<std::byte>(chunk << (free_ - k));
+        free_ -= k;
+        n -= k;
+      }
+    }
+
+  public:
+    void start(std::uint64_t first, std::vector<std::byte>&) noexcept
+    {
+      free_ = 0;  // every block starts at a byte boundary
+      prev_ = first;
+      leading_ = Bits + 1;
+      trailing_ = 0;
+    }
+
+    void put(std::uint64_t v, std::vector<std::byte>& out)
+    {
+      const std::uint64_t x = v ^ prev_;
+      prev_ = v;
+      if (x == 0) {
+        write(out, 0, 1);
+        return;
+      }
+      const unsigned leading = std::min(static_cast<unsigned>(std::countl_zero(x)) - (64 - Bits), 31u);
+      const auto trailing = static_cast<unsigned>(std::countr_zero(x));
+      if (leading_ <= Bits && leading >= leading_ && trailing >= trailing_) {
+        write(out, 0b10, 2);
+        write(out, x >> trailing_, Bits - leading_ - trailing_);
+      }
+      else {
+        const unsigned length = Bits - leading - trailing;
+        write(out, 0b11, 2);
+        write(out, leading, 5);
+        write(out, length - 1, 6);
+        write(out, x >> trailing, length);
+        leading_ = leading;
+        trailing_ = trailing;
+      }
+    }
+  };
+
+  class decoder {
+    const std::byte* pos_;
+    unsigned bit_ = 0;  // bits already read from the current byte
+    std::uint64_t prev_;
+    unsigned leading_ = 0;
+    unsigned trailing_ = 0;
+
+    [[nodiscard]] std::uint64_t read(unsigned n) noexcept
+    {
+      std::uint64_t res = 0;
+      while (n > 0) {
+        const unsigned avail = 8 - bit_;
+        const unsigned k = std::min(n, avail);
+        const auto chunk = (std::to_integer<unsigned>(*pos_) >> (avail - k)) & ((1u << k) - 1);
+        res = (res << k) | chunk;
+        bit_ += k;
+        n -= k;
+        if (bit_ == 8) {
+          ++pos_;
+          bit_ = 0;
+        }
+      }
+      return res;
+    }
+
+  public:
+    decoder(const std::byte* pos, std::uint64_t first) noexcept : pos_(pos), prev_(first) {}
+
+    [[nodiscard]] std::uint64_t next() noexcept
+    {
+      if (read(1) == 0) return prev_;
+      if (read(1) == 1) {
+        leading_ = static_cast<unsigned>(read(5));
+        trailing_ = Bits - leading_ - (static_cast<unsigned>(read(6)) + 1);
+      }
+      prev_ ^= read(Bits - leading_ - trailing_) << trailing_;
+      return prev_;
+    }
+  };
+};
+
+template<typename Rep>
+struct compressed_rep_traits {
+  using codec = delta_of_delta_codec;
+  using signed_type = std::conditional_t<std::is_signed_v<Rep>, std::int64_t, std::uint64_t>;
+
+  [[nodiscard]] static constexpr std::uint64_t to_bits(Rep v) noexcept
+  {
+    return static_cast<std::uint64_t>(static_cast<signed_type>(v));
+  }
+
+  [[nodiscard]] static constexpr Rep from_bits(std::uint64_t bits) noexcept { return static_cast<Rep>(bits); }
+};
+
+template<std::floating_point Rep>
+struct compressed_rep_traits<Rep> {
+  using uint_type = std::conditional_t<sizeof(Rep) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+  using codec = xor_codec<8 * sizeof(Rep)>;
+
+  [[nodiscard]] static constexpr std::uint64_t to_bits(Rep v) noexcept { return std::bit_cast<uint_type>(v); }
+  [[nodiscard]] static constexpr Rep from_bits(std::uint64_t bits) noexcept
+  {
+    return std::bit_cast<Rep>(static_cast<uint_type>(bits));
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A compressed sequence container of quantities or quantity points
+ *
+ * Meant for long histories of slowly varying values (i.e. timestamps or sensor measurements).
+ * The values are stored at the resolution of the unit of @c T (values of other units are
+ * converted with `quantity_cast()` or `quantity_point_cast()` on insertion):
+ * - integral representation values are encoded as zig-zag varints of the delta-of-delta of
+ *   consecutive values,
+ * - floating-point ones as XOR of their consecutive bit patterns (as in the Gorilla time series
+ *   database) which keeps them exact.
+ *
+ * Values are split into blocks of @c BlockSize elements and each block starts with a full value
+ * stored in a block index so any element is decoded with at most @c BlockSize steps. For example:
+ *
+ * units::compressed_series<quantity_point<si::dim_time, si::millisecond, std::int64_t>> timestamps;
+ * timestamps.push_back(t);
+ * std::vector<quantity_point<si::dim_time, si::millisecond, std::int64_t>> buffer(1024);
+ * auto decoded = timestamps.decode(first, std::span(buffer));
+ *
+ * @tparam T a quantity or a quantity point with an integral, `float`, or `double` representation
+ * @tparam BlockSize the number of elements in every block
+ */
+template<typename T, std::size_t BlockSize = 256>
+  requires detail::compressible_element<T> && (BlockSize > 0)
+class compressed_series {
+  using traits = detail::compressed_rep_traits<typename T::rep>;
+  using codec = TYPENAME traits::codec;
+
+  struct block {
+    std::size_t offset;   // of the encoded values in `data_`
+    std::uint64_t first;  // bits of the first value of the block
+  };
+
+  std::vector<std::byte> data_;
+  std::vector<block> blocks_;
+  std::size_t size_ = 0;
+  typename codec::encoder encoder_;
+  std::uint64_t last_ = 0;
+
+  [[nodiscard]] static constexpr T make(std::uint64_t bits)
+  {
+    if constexpr (QuantityPoint<T>)
+      return T(quantity_type(traits::from_bits(bits)));
+    else
+      return T(traits::from_bits(bits));
+  }
+
+  // passes the bits of `count` values starting from the element `first` to `f(index, bits)`
+  template<typename F>
+  void decode_bits(std::size_t first, std::size_t count, F f) const
+  {
+    std::size_t b = first / BlockSize;
+    std::size_t skip = first % BlockSize;
+    for (std::size_t i = 0; i < count; ++b, skip = 0) {
+      typename codec::decoder dec(data_.data() + blocks_[b].offset, blocks_[b].first);
+      const std::size_t block_end = std::min(BlockSize, size_ - b * BlockSize);
+      std::uint64_t bits = blocks_[b].first;
+      for (std::size_t j = 0; j < skip; ++j) bits = dec.next();
+      for (std::size_t j = skip; j < block_end && i < count; ++j, ++i) {
+        if (j != skip) bits = dec.next();
+        f(i, bits);
+      }
+    }
+  }
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using quantity_type = TYPENAME detail::element_quantity<T>::type;
+  static constexpr size_type block_size = BlockSize;
+
+  compressed_series() = default;
+
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+  /**
+   * @brief The number of blocks of the block index
+   */
+  [[nodiscard]] size_type block_count() const noexcept { return blocks_.size(); }
+
+  /**
+   * @brief The number of bytes used by the encoded values and the block index
+   */
+  [[nodiscard]] size_type memory_size() const noexcept
+  {
+    return data_.size() + blocks_.size() * sizeof(block);
+  }
+
+  void reserve_bytes(size_type count) { data_.reserve(count); }
+
+  void shrink_to_fit()
+  {
+    data_.shrink_to_fit();
+    blocks_.shrink_to_fit();
+  }
+
+  void clear() noexcept
+  {
+    data_.clear();
+    blocks_.clear();
+    size_ = 0;
+  }
+
+  void push_back(const T& v)
+  {
+    last_ = traits::to_bits(detail::rep_of(v));
+    if (size_ % BlockSize == 0) {
+      blocks_.push_back({data_.size(), last_});
+      encoder_.start(last_, data_);
+    }
+    else {
+      encoder_.put(last_, data_);
+    }
+    ++size_;
+  }
+
+  /**
+   * @brief Appends a quantity point of another unit or representation type at the resolution of @c T
+   */
+  template<QuantityPoint QP>
+    requires QuantityPoint<T> && (!std::same_as<QP, T>) && requires(const QP& v) { T(quantity_point_cast<T>(v)); }
+  void push_back(const QP& v)
+  {
+    push_back(T(quantity_point_cast<T>(v)));
+  }
+
+  /**
+   * @brief Appends a quantity of another unit or representation type at the resolution of @c T
+   */
+  template<Quantity Q>
+    requires Quantity<T> && (!std::same_as<Q, T>) && requires(const Q& v) { T(quantity_cast<T>(v)); }
+  void push_back(const Q& v)
+  {
+    push_back(T(quantity_cast<T>(v)));
+  }
+
+  /**
+   * @brief Decodes a single element (at most `BlockSize` decoding steps)
+   */
+  [[nodiscard]] T operator[](size_type pos) const
+  {
+    Expects(pos < size_);
+    std::uint64_t res = 0;
+    decode_bits(pos, 1, [&](std::size_t, std::uint64_t bits) { res = bits; });
+    return make(res);
+  }
+
+  [[nodiscard]] T front() const { return (*this)[0]; }
+  [[nodiscard]] T back() const
+  {
+    Expects(size_ > 0);
+    return make(last_);
+  }
+
+  /**
+   * @brief Decodes consecutive elements starting from @c first to @c out
+   *
+   * @return the decoded part of @c out (shorter than @c out at the end of the series)
+   */
+  std::span<T> decode(size_type first, std::span<T> out) const
+  {
+    Expects(first <= size_);
+    const size_type count = std::min(out.size(), size_ - first);
+    decode_bits(first, count, [&](std::size_t i, std::uint64_t bits) { out[i] = make(bits); });
+    return out.first(count);
+  }
+
+  /**
+   * @brief Decodes values of consecutive quantity points starting from @c first to @c out
+   *
+   * The values are quantities relative to the origin of @c T.
+   *
+   * @return the decoded part of @c out (shorter than @c out at the end of the series)
+   */
+  quantity_span<quantity_type> decode(size_type first, quantity_span<quantity_type> out) const
+    requires QuantityPoint<T> && RepLayoutQuantity<quantity_type>
+  {
+    Expects(first <= size_);
+    const size_type count = std::min(out.size(), size_ - first);
+    decode_bits(first, count,
+                [&](std::size_t i, std::uint64_t bits) { out[i] = quantity_type(traits::from_bits(bits)); });
+    return out.first(count);
+  }
+};
+
+}  // namespace units
@@ -0,0 +1,180 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/bits/equivalent.h>
+#include <units/hash.h>
+#include <units/quantity_cast.h>
+#include <units/registry.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace units {
+
+namespace detail {
+
+struct no_runtime_scale {};
+
+template<Quantity Q>
+struct converter_entry {
+  using rep = TYPENAME Q::rep;
+  using factor_type = std::remove_const_t<decltype(conversion_factor_v<Q, Q>)>;
+
+  std::uint64_t unit_id;
+  factor_type factor;
+  Q (*convert)(const rep&);
+  // `factor` with the reciprocal of its divisor precomputed for the integral representation types
+  [[no_unique_address]] std::conditional_t<std::integral<rep>, runtime_scale, no_runtime_scale> scale{};
+};
+
+// units of other dimensions are converted with the exact ratio only if they share the reference unit
+// with Q (the exact ratio of i.e. FPS and SI units of energy is not representable with `ratio`) so for
+// integral representation types only such units with a representable `integral_factor` are supported
+template<Quantity Q, typename U>
+[[nodiscard]] consteval bool integral_convertible()
+{
+  if constexpr (UnitOf<U, typename Q::dimension>)
+    return has_integral_factor(U::ratio / Q::unit::ratio);
+  else
+    return false;
+}
+
+template<Quantity Q, typename D, typename U>
+inline constexpr bool converter_accepts =
+  equivalent<D, typename Q::dimension> && (treat_as_floating_point<typename Q::rep> || integral_convertible<Q, U>());
+
+template<Quantity Q, typename D, typename U>
+[[nodiscard]] consteval converter_entry<Q> make_converter_entry()
+{
+  using rep = TYPENAME Q::rep;
+  if constexpr (UnitOf<U, typename Q::dimension>) {
+    constexpr auto factor = conversion_factor_v<quantity<typename Q::dimension, U, rep>, Q>;
+    if constexpr (std::integral<rep>)
+      return {unit_id<D, U>, factor, &convert_from<Q, U>,
+              make_runtime_scale(static_cast<std::uint64_t>(factor.multiplier), static_cast<std::uint64_t>(factor.divisor))};
+    else
+      return {unit_id<D, U>, factor, &convert_from<Q, U>};
+  }
+  else
+    return {unit_id<D, U>, packed_scale<D, U> / packed_scale<typename Q::dimension, typename Q::unit>, nullptr};
+}
+
+template<Quantity Q, typename D, typename... Us>
+[[nodiscard]] consteval std::size_t converter_units_count(registry_units<D, Us...>)
+{
+  return (std::size_t(converter_accepts<Q, D, Us>) + ... + 0);
+}
+
+template<Quantity Q, std::size_t N, typename D, typename... Us>
+constexpr void append_converter_entries(registry_units<D, Us...>, std::array<converter_entry<Q>, N>& entries, std::size_t& size)
+{
+  ([&] {
+    if constexpr (converter_accepts<Q, D, Us>) entries[size++] = make_converter_entry<Q, D, Us>();
+  }(), ...);
+}
+
+// entries for all the registered units of the dimensions equivalent to the one of Q sorted by `unit_id`
+template<Quantity Q, typename... Groups>
+[[nodiscard]] consteval auto make_converter_entries(registry_groups<Groups...>)
+{
+  constexpr std::size_t count = (converter_units_count<Q>(Groups()) + ... + 0);
+  std::array<converter_entry<Q>, count> entries{};
+  std::size_t size = 0;
+  (append_converter_entries<Q>(Groups(), entries, size), ...);
+  std::ranges::sort(entries, {}, &converter_entry<Q>::unit_id);
+  return entries;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Converts values in a unit known only at runtime to the quantity @c Q
+ *
+ * A converter is created for the `unit_id` of a source unit (i.e. provided in the header of a
+ * message) and then converts values in that unit with the conversion factor precomputed at
+ * compile time (a single multiplication for the floating-point representation types and an exact
+ * integral scaling with a precomputed reciprocal of the divisor for the integral ones).
+ *
+ * The table of the conversion factors is generated at compile time for all the units of the
+ * `registry` having a dimension equivalent to the one of @c Q (i.e. units of the SI, CGS, and
+ * FPS systems). A new unit is supported once it is added to the list of the registered units
+ * (`registered_units` in `units/bits/registered_units.h`). For integral representation types
+ * only the units having the same reference unit as the unit of @c Q are supported.
+ *
+ * @tparam Q a quantity type to convert to
+ */
+template<Quantity Q>
+class converter {
+  using entry = detail::converter_entry<Q>;
+  static constexpr auto entries_ = detail::make_converter_entries<Q>(detail::registered_units());
+
+  const entry* entry_;
+
+  [[nodiscard]] static constexpr const entry* find(std::uint64_t unit_id) noexcept
+  {
+    const auto it = std::ranges::lower_bound(entries_, unit_id, {}, &entry::unit_id);
+    return it != entries_.end() && it->unit_id == unit_id ? &*it : nullptr;
+  }
+
+public:
+  using quantity_type = Q;
+  using rep = TYPENAME Q::rep;
+  using factor_type = TYPENAME entry::factor_type;
+
+  /**
+   * @brief A converter for values in the unit with the provided `unit_id`
+   *
+   * @throws std::invalid_argument if @c unit_id is not an identifier of a registered unit of
+   *         the dimension of @c Q
+   */
+  explicit constexpr converter(std::uint64_t unit_id) : entry_(find(unit_id))
+  {
+    if (entry_ == nullptr) throw std::invalid_argument("unit not convertible to the quantity");
+  }
+
+  /**
+   * @brief Returns true if values in the unit with the provided `unit_id` can be converted
+   */
+  [[nodiscard]] static constexpr bool contains(std::uint64_t unit_id) noexcept { return find(unit_id) != nullptr; }
+
+  /**
+   * @brief The conversion factor from the source unit (as in `conversion_factor_v`)
+   */
+  [[nodiscard]] constexpr factor_type factor() const noexcept { return entry_->factor; }
+
+  [[nodiscard]] constexpr Q operator()(const rep& value) const
+  {
+    if constexpr (std::is_floating_point_v<factor_type>)
+      return Q(static_cast<rep>(value * entry_->factor));
+    else if constexpr (std::integral<rep>)
+      return Q(detail::scale_integral(value, entry_->scale));
+    else
+      return entry_->convert(value);
+  }
+};
+
+}  // namespace units
@@ -0,0 +1,294 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/bits/base_units_ratio.h>
+#include <units/concepts.h>
+#include <units/quantity.h>
+#include <units/ratio.h>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+namespace units {
+
+namespace detail {
+
+// base dimensions known to `packed_dimension` (identified by their symbols)
+inline constexpr std::array<std::string_view, 9> packed_base_dimensions = {
+  "L", "M", "T", "I", "Θ", "N", "J", "A", "information"};
+
+inline constexpr unsigned packed_exponent_bits = 7;
+
+// the most significant bit of every exponent field
+inline constexpr std::uint64_t packed_exponent_sign_bits = [] {
+  std::uint64_t bits = 0;
+  for (std::size_t i = 0; i < packed_base_dimensions.size(); ++i)
+    bits |= std::uint64_t(1) << (i * packed_exponent_bits + packed_exponent_bits - 1);
+  return bits;
+}();
+
+template<BaseDimension D>
+[[nodiscard]] consteval std::size_t packed_slot()
+{
+  const std::string_view symbol(D::symbol.c_str(), D::symbol.size());
+  for (std::size_t i = 0; i < packed_base_dimensions.size(); ++i)
+    if (packed_base_dimensions[i] == symbol) return i;
+  return packed_base_dimensions.size();
+}
+
+template<typename... Es>
+[[nodiscard]] consteval bool packable(exponent_list<Es...>)
+{
+  return ((packed_slot<typename Es::dimension>() < packed_base_dimensions.size() &&
+           (Es::den == 1 || Es::den == 2)) && ...);
+}
+
+template<Dimension D>
+struct base_exponents_impl {
+  using type = TYPENAME D::exponents;
+};
+
+template<BaseDimension D>
+struct base_exponents_impl<D> {
+  using type = exponent_list<exponent<D, 1>>;
+};
+
+template<Dimension D>
+using base_exponents = TYPENAME base_exponents_impl<D>::type;
+
+}  // namespace detail
+
+/**
+ * @brief Exponents of base dimensions of a dimension packed into a single 64-bit word
+ *
+ * Every base dimension with one of the symbols of the SI base quantities ("L", "M", "T", "I",
+ * "Θ", "N", "J"), the angle ("A"), and the information ("information") has a 7-bit field
+ * storing a doubled exponent (so the square roots are supported), which gives the range of
+ * [-32, 31.5] for each exponent. Multiplication and division of dimensions are additions and
+ * subtractions of all the fields at once and the comparison is a comparison of integers.
+ */
+class packed_dimension {
+  std::uint64_t bits_ = 0;
+
+  constexpr explicit packed_dimension(std::uint64_t bits) noexcept : bits_(bits) {}
+
+  template<typename... Es>
+  [[nodiscard]] static consteval std::uint64_t pack(exponent_list<Es...>)
+  {
+    constexpr std::uint64_t mask = (std::uint64_t(1) << detail::packed_exponent_bits) - 1;
+    return (((static_cast<std::uint64_t>(2 * Es::num / Es::den) & mask)
+             << (detail::packed_slot<typename Es::dimension>() * detail::packed_exponent_bits)) | ... | 0);
+  }
+
+public:
+  /**
+   * @brief A dimension of a dimensionless quantity
+   */
+  constexpr packed_dimension() = default;
+
+  /**
+   * @brief Packed exponents of the dimension @c D
+   */
+  template<Dimension D>
+    requires (detail::packable(detail::base_exponents<D>()))
+  [[nodiscard]] static constexpr packed_dimension of() noexcept
+  {
+    return packed_dimension(pack(detail::base_exponents<D>()));
+  }
+
+  [[nodiscard]] constexpr std::uint64_t bits() const noexcept { return bits_; }
+
+  /**
+   * @brief Returns the exponent of a base dimension with the provided symbol
+   */
+  [[nodiscard]] constexpr double exponent(std::string_view symbol) const noexcept
+  {
+    for (std::size_t i = 0; i < detail::packed_base_dimensions.size(); ++i) {
+      if (detail::packed_base_dimensions[i] == symbol) {
+        const auto field = static_cast<unsigned>(bits_ >> (i * detail::packed_exponent_bits)) &
+                           ((1u << detail::packed_exponent_bits) - 1);
+        const int doubled = field >= (1u << (detail::packed_exponent_bits - 1))
+                              ? static_cast<int>(field) - (1 << detail::packed_exponent_bits)
+                              : static_cast<int>(field);
+        return doubled / 2.;
+      }
+    }
+    return 0;
+  }
+
+  [[nodiscard]] friend constexpr packed_dimension operator*(packed_dimension lhs, packed_dimension rhs) noexcept
+  {
+    constexpr std::uint64_t h = detail::packed_exponent_sign_bits;
+    return packed_dimension(((lhs.bits_ & ~h) + (rhs.bits_ & ~h)) ^ ((lhs.bits_ ^ rhs.bits_) & h));
+  }
+
+  [[nodiscard]] friend constexpr packed_dimension operator/(packed_dimension lhs, packed_dimension rhs) noexcept
+  {
+    constexpr std::uint64_t h = detail::packed_exponent_sign_bits;
+    return packed_dimension(((lhs.bits_ | h) - (rhs.bits_ & ~h)) ^ ((lhs.bits_ ^ ~rhs.bits_) & h));
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(packed_dimension, packed_dimension) = default;
+};
+
+namespace detail {
+
+[[nodiscard]] constexpr double to_double(const ratio& r)
+{
+  double factor = static_cast<double>(r.num) / static_cast<double>(r.den);
+  for (auto e = r.exp; e > 0; --e) factor *= 10;
+  for (auto e = r.exp; e < 0; ++e) factor /= 10;
+  return factor;
+}
+
+// ratio of the unit U of the dimension D to the product of the references of the base units
+// (units of base dimensions are already expressed in terms of their references; the ratios are
+// multiplied as floating-point values as their exact product may not be representable)
+template<Dimension D, UnitOf<D> U>
+inline constexpr double packed_scale = [] {
+  if constexpr (BaseDimension<D>)
+    return to_double(U::ratio);
+  else
+    return to_double(U::ratio) * to_double(base_units_ratio(typename D::exponents()));
+}();
+
+[[noreturn]] inline void throw_dimension_mismatch()
+{
+  throw std::invalid_argument("dimensions of quantities do not match");
+}
+
+}  // namespace detail
+
+/**
+ * @brief A quantity with a dimension known only at runtime
+ *
+ * Holds a `double` value, the scale of its unit (relative to the product of the references of
+ * base units, i.e. metre, gram, second), and the `packed_dimension`. It is meant for the
+ * boundaries of a program (scripting, configuration, plugins) where the dimension of a quantity
+ * is not known at compile time.
+ *
+ * Every `quantity` with the dimension expressible with `packed_dimension` converts implicitly
+ * to `dynamic_quantity`. The conversion back is done with a `quantity_cast()` that throws
+ * `std::invalid_argument` if the dimensions do not match.
+ */
+class dynamic_quantity {
+  double value_ = 0;
+  double scale_ = 1;
+  packed_dimension dimension_;
+
+public:
+  constexpr dynamic_quantity() = default;
+
+  constexpr dynamic_quantity(double v, double scale, packed_dimension d) noexcept :
+    value_(v), scale_(scale), dimension_(d)
+  {
+  }
+
+  template<typename D, typename U, typename Rep>
+    requires requires { packed_dimension::of<D>(); }
+  constexpr dynamic_quantity(const quantity<D, U, Rep>& q) :
+    value_(static_cast<double>(q.count())), scale_(detail::packed_scale<D, U>), dimension_(packed_dimension::of<D>())
+  {
+  }
+
+  [[nodiscard]] constexpr double value() const noexcept { return value_; }
+  [[nodiscard]] constexpr double scale() const noexcept { return scale_; }
+  [[nodiscard]] constexpr packed_dimension dimension() const noexcept { return dimension_; }
+
+  /**
+   * @brief The value expressed in the product of the references of base units
+   */
+  [[nodiscard]] constexpr double base_value() const noexcept { return value_ * scale_; }
+
+  [[nodiscard]] constexpr dynamic_quantity operator-() const noexcept { return {-value_, scale_, dimension_}; }
+
+  [[nodiscard]] friend constexpr dynamic_quantity operator+(const dynamic_quantity& lhs, const dynamic_quantity& rhs)
+  {
+    if (lhs.dimension_ != rhs.dimension_) detail::throw_dimension_mismatch();
+    return {lhs.value_ + rhs.value_ * (rhs.scale_ / lhs.scale_), lhs.scale_, lhs.dimension_};
+  }
+
+  [[nodiscard]] friend constexpr dynamic_quantity operator-(const dynamic_quantity& lhs, const dynamic_quantity& rhs)
+  {
+    if (lhs.dimension_ != rhs.dimension_) detail::throw_dimension_mismatch();
+    return {lhs.value_ - rhs.value_ * (rhs.scale_ / lhs.scale_), lhs.scale_, lhs.dimension_};
+  }
+
+  [[nodiscard]] friend constexpr dynamic_quantity operator*(const dynamic_quantity& lhs, const dynamic_quantity& rhs) noexcept
+  {
+    return {lhs.value_ * rhs.value_, lhs.scale_ * rhs.scale_, lhs.dimension_ * rhs.dimension_};
+  }
+
+  [[nodiscard]] friend constexpr dynamic_quantity operator/(const dynamic_quantity& lhs, const dynamic_quantity& rhs) noexcept
+  {
+    return {lhs.value_ / rhs.value_, lhs.scale_ / rhs.scale_, lhs.dimension_ / rhs.dimension_};
+  }
+
+  [[nodiscard]] friend constexpr dynamic_quantity operator*(const dynamic_quantity& q, double v) noexcept
+  {
+    return {q.value_ * v, q.scale_, q.dimension_};
+  }
+
+  [[nodiscard]] friend constexpr dynamic_quantity operator*(double v, const dynamic_quantity& q) noexcept
+  {
+    return q * v;
+  }
+
+  [[nodiscard]] friend constexpr dynamic_quantity operator/(const dynamic_quantity& q, double v) noexcept
+  {
+    return {q.value_ / v, q.scale_, q.dimension_};
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const dynamic_quantity& lhs, const dynamic_quantity& rhs)
+  {
+    if (lhs.dimension_ != rhs.dimension_) detail::throw_dimension_mismatch();
+    return lhs.base_value() == rhs.base_value();
+  }
+
+  [[nodiscard]] friend constexpr std::partial_ordering operator<=>(const dynamic_quantity& lhs, const dynamic_quantity& rhs)
+  {
+    if (lhs.dimension_ != rhs.dimension_) detail::throw_dimension_mismatch();
+    return lhs.base_value() <=> rhs.base_value();
+  }
+};
+
+/**
+ * @brief Checked cast of a dynamic quantity to a quantity
+ *
+ * @throws std::invalid_argument if the dimension of @c q is not the dimension of @c To
+ */
+template<Quantity To>
+  requires std::constructible_from<dynamic_quantity, To>
+[[nodiscard]] constexpr To quantity_cast(const dynamic_quantity& q)
+{
+  using rep = TYPENAME To::rep;
+  if (q.dimension() != packed_dimension::of<typename To::dimension>()) detail::throw_dimension_mismatch();
+  return To(static_cast<rep>(q.value() * (q.scale() / detail::packed_scale<typename To::dimension, typename To::unit>)));
+}
+
+}  // namespace units
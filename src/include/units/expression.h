@@ -0,0 +1,516 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/dynamic_quantity.h>
+#include <units/registry.h>
+#include <gsl/gsl_assert>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace units {
+
+/**
+ * @brief A named variable of an expression compiled with `compile_expression()`
+ *
+ * Values bound to the variable are expressed in the unit with the provided @c factor (the
+ * ratio to the product of the references of base units as in `unit_info::factor`).
+ */
+struct expression_variable {
+  std::string_view name;
+  packed_dimension dimension;
+  double factor = 1;
+
+  constexpr expression_variable(std::string_view n, packed_dimension d, double f = 1) noexcept :
+    name(n), dimension(d), factor(f)
+  {
+  }
+
+  constexpr expression_variable(std::string_view n, const unit_info& unit) noexcept :
+    name(n), dimension(unit.dimension), factor(unit.factor)
+  {
+  }
+};
+
+namespace detail {
+
+enum class expression_op : std::uint8_t { constant, load, add, subtract, multiply, divide };
+
+struct expression_instruction {
+  expression_op op;
+  std::uint32_t index = 0;  // index of a variable for `load`
+  double value = 0;         // a constant or a factor of a loaded variable
+};
+
+inline constexpr std::size_t max_expression_stack = 32;
+
+/**
+ * @brief Recursive descent parser of unit expressions
+ *
+ * Builds a tree of the expression checking the dimensions of operands on the way and folding
+ * all the constants (including the conversion factors of unit symbols and of the variables)
+ * into as few nodes as possible. The tree is then emitted as a postfix program.
+ */
+class expression_parser {
+  struct node {
+    expression_op op;
+    double value = 0;
+    std::uint32_t index = 0;
+    std::size_t lhs = 0;
+    std::size_t rhs = 0;
+  };
+
+  struct operand {
+    std::size_t node;
+    packed_dimension dimension;
+  };
+
+  std::string_view text_;
+  std::size_t pos_ = 0;
+  std::span<const expression_variable> variables_;
+  std::vector<node> nodes_;
+
+  [[noreturn]] void fail(std::string_view what) const
+  {
+    throw std::invalid_argument(std::string(what) + " at position " + std::to_string(pos_) + " of '" +
+                                std::string(text_) + "'");
+  }
+
+  void skip_spaces()
+  {
+    while (pos_ < text_.size() && (text_[pos_] == ' ' || text_[pos_] == '\t')) ++pos_;
+  }
+
+  [[nodiscard]] bool consume(char c)
+  {
+    skip_spaces();
+    if (pos_ < text_.size() && text_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  [[nodiscard]] static constexpr bool is_identifier_char(char c) noexcept
+  {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+  }
+
+  // a unit symbol may contain also non-ASCII characters (UTF-8 sequences of i.e. 'µ' or '²')
+  // and '/', '*', '^' of the symbols of derived units (i.e. "km/h" or "m^2")
+  [[nodiscard]] static constexpr bool is_unit_char(char c) noexcept
+  {
+    return is_identifier_char(c) || static_cast<unsigned char>(c) >= 0x80 || c == '/' || c == '*' || c == '^';
+  }
+
+  [[nodiscard]] std::size_t make_constant(double v)
+  {
+    nodes_.push_back({expression_op::constant, v});
+    return nodes_.size() - 1;
+  }
+
+  [[nodiscard]] std::size_t make_binary(expression_op op, std::size_t lhs, std::size_t rhs)
+  {
+    nodes_.push_back({op, 0, 0, lhs, rhs});
+    return nodes_.size() - 1;
+  }
+
+  // multiplies the value of a node by a constant pushing it down to a constant or a variable
+  // load whenever possible (walks the left operands of products and quotients in a loop as a long
+  // chain of them forms a tree as deep as the number of operators)
+  [[nodiscard]] std::size_t scale(std::size_t n, double f)
+  {
+    if (f == 1) return n;
+    std::size_t parent = n;
+    std::size_t target = n;
+    while (nodes_[target].op == expression_op::multiply || nodes_[target].op == expression_op::divide) {
+      parent = target;
+      target = nodes_[target].lhs;
+    }
+    if (nodes_[target].op == expression_op::constant || nodes_[target].op == expression_op::load) {
+      nodes_[target].value *= f;
+      return n;
+    }
+    const std::size_t scaled = make_binary(expression_op::multiply, target, make_constant(f));
+    if (target == n) return scaled;
+    nodes_[parent].lhs = scaled;
+    return n;
+  }
+
+  [[nodiscard]] bool is_constant(std::size_t n) const { return nodes_[n].op == expression_op::constant; }
+
+  [[nodiscard]] operand combine(char op, const operand& lhs, const operand& rhs)
+  {
+    const double l = nodes_[lhs.node].value;
+    const double r = nodes_[rhs.node].value;
+    switch (op) {
+      case '+':
+      case '-': {
+        if (lhs.dimension != rhs.dimension) fail(std::string("dimensions of operands of '") + op + "' do not match");
+        if (is_constant(lhs.node) && is_constant(rhs.node)) return {make_constant(op == '+' ? l + r : l - r), lhs.dimension};
+        return {make_binary(op == '+' ? expression_op::add : expression_op::subtract, lhs.node, rhs.node), lhs.dimension};
+      }
+      case '*': {
+        const packed_dimension d = lhs.dimension * rhs.dimension;
+        if (is_constant(lhs.node)) return {scale(rhs.node, l), d};
+        if (is_constant(rhs.node)) return {scale(lhs.node, r), d};
+        return {make_binary(expression_op::multiply, lhs.node, rhs.node), d};
+      }
+      default: {
+        const packed_dimension d = lhs.dimension / rhs.dimension;
+        if (is_constant(rhs.node)) return {scale(lhs.node, 1 / r), d};
+        return {make_binary(expression_op::divide, lhs.node, rhs.node), d};
+      }
+    }
+  }
+
+  // the longest registered unit symbol at the current position (the symbol may be followed by
+  // an operator without a space between them as in "20 min/2")
+  [[nodiscard]] const unit_info* parse_unit()
+  {
+    std::size_t last = pos_;
+    while (last < text_.size() && is_unit_char(text_[last])) ++last;
+    for (std::size_t end = last; end > pos_; --end) {
+      if (end != last && text_[end] != '/' && text_[end] != '*' && text_[end] != '^') continue;
+      if (const unit_info* unit = registry::find(text_.substr(pos_, end - pos_))) {
+        pos_ = end;
+        return unit;
+      }
+    }
+    return nullptr;
+  }
+
+  [[nodiscard]] operand parse_number()
+  {
+    double v = 0;
+    const char* first = text_.data() + pos_;
+    const auto res = std::from_chars(first, text_.data() + text_.size(), v);
+    if (res.ec != std::errc()) fail("invalid number");
+    pos_ += static_cast<std::size_t>(res.ptr - first);
+    skip_spaces();
+    if (pos_ < text_.size() && is_unit_char(text_[pos_]) && !(text_[pos_] >= '0' && text_[pos_] <= '9') &&
+        text_[pos_] != '/' && text_[pos_] != '*' && text_[pos_] != '^') {
+      const unit_info* unit = parse_unit();
+      if (unit == nullptr) fail("unknown unit");
+      return {make_constant(v * unit->factor), unit->dimension};
+    }
+    return {make_constant(v), packed_dimension()};
+  }
+
+  [[nodiscard]] operand parse_identifier()
+  {
+    const std::size_t first = pos_;
+    while (pos_ < text_.size() && is_identifier_char(text_[pos_])) ++pos_;
+    const std::string_view name = text_.substr(first, pos_ - first);
+    for (std::size_t i = 0; i < variables_.size(); ++i) {
+      if (variables_[i].name == name) {
+        nodes_.push_back({expression_op::load, variables_[i].factor, static_cast<std::uint32_t>(i)});
+        return {nodes_.size() - 1, variables_[i].dimension};
+      }
+    }
+    pos_ = first;
+    const unit_info* unit = parse_unit();
+    if (unit == nullptr) fail("unknown variable or unit '" + std::string(name) + "'");
+    return {make_constant(unit->factor), unit->dimension};
+  }
+
+  [[nodiscard]] operand parse_primary(std::size_t depth)
+  {
+    if (depth > max_expression_stack) fail("expression nested too deeply");
+    skip_spaces();
+    if (pos_ == text_.size()) fail("unexpected end of expression");
+    const char c = text_[pos_];
+    if (c == '(') {
+      ++pos_;
+      const operand res = parse_sum(depth + 1);
+      if (!consume(')')) fail("missing ')'");
+      return res;
+    }
+    if (c == '-') {
+      ++pos_;
+      const operand res = parse_primary(depth + 1);
+      return {scale(res.node, -1), res.dimension};
+    }
+    if ((c >= '0' && c <= '9') || c == '.') return parse_number();
+    if (is_identifier_char(c) || static_cast<unsigned char>(c) >= 0x80) return parse_identifier();
+    fail(std::string("unexpected character '") + c + "'");
+  }
+
+  [[nodiscard]] operand parse_product(std::size_t depth)
+  {
+    operand res = parse_primary(depth);
+    for (;;) {
+      if (consume('*')) res = combine('*', res, parse_primary(depth));
+      else if (consume('/')) res = combine('/', res, parse_primary(depth));
+      else return res;
+    }
+  }
+
+  [[nodiscard]] operand parse_sum(std::size_t depth)
+  {
+    operand res = parse_product(depth);
+    for (;;) {
+      if (consume('+')) res = combine('+', res, parse_product(depth));
+      else if (consume('-')) res = combine('-', res, parse_product(depth));
+      else return res;
+    }
+  }
+
+  // emits the subtree in a postfix order and returns the depth of the stack used by it (iterative
+  // for the same reason as `scale()`)
+  std::size_t emit(std::size_t root, std::vector<expression_instruction>& code) const
+  {
+    struct pending_node {
+      std::size_t node;
+      bool operands_emitted;
+    };
+    std::vector<pending_node> pending = {{root, false}};
+    std::vector<std::size_t> depths;  // stack depths of the subtrees emitted so far
+    while (!pending.empty()) {
+      const pending_node p = pending.back();
+      pending.pop_back();
+      const node& nd = nodes_[p.node];
+      if (nd.op == expression_op::constant || nd.op == expression_op::load) {
+        code.push_back({nd.op, nd.index, nd.value});
+        depths.push_back(1);
+      }
+      else if (!p.operands_emitted) {
+        pending.push_back({p.node, true});
+        pending.push_back({nd.rhs, false});
+        pending.push_back({nd.lhs, false});
+      }
+      else {
+        code.push_back({nd.op});
+        const std::size_t rhs = depths.back();
+        depths.pop_back();
+        depths.back() = std::max(depths.back(), rhs + 1);
+      }
+    }
+    return depths.empty() ? 0 : depths.back();
+  }
+
+public:
+  struct result {
+    std::vector<expression_instruction> code;
+    std::size_t stack_size;
+    packed_dimension dimension;
+  };
+
+  expression_parser(std::string_view text, std::span<const expression_variable> variables) :
+    text_(text), variables_(variables)
+  {
+  }
+
+  [[nodiscard]] result parse(const unit_info* result_unit)
+  {
+    operand res = parse_sum(0);
+    skip_spaces();
+    if (pos_ != text_.size()) fail("unexpected character");
+    if (result_unit != nullptr) {
+      if (res.dimension != result_unit->dimension) fail("dimension of the expression does not match the result unit");
+      res.node = scale(res.node, 1 / result_unit->factor);
+    }
+    std::vector<expression_instruction> code;
+    const std::size_t stack_size = emit(res.node, code);
+    if (stack_size > max_expression_stack) fail("expression nested too deeply");
+    return {std::move(code), stack_size, res.dimension};
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief An expression compiled with `compile_expression()`
+ *
+ * A flat postfix program with all the unit conversion factors folded into its constants and
+ * variable loads. The dimensional analysis was done while compiling so evaluating it is only
+ * the arithmetic of its values.
+ */
+class compiled_expression {
+  std::vector<detail::expression_instruction> code_;
+  std::vector<expression_variable> variables_;
+  std::size_t stack_size_ = 1;
+  packed_dimension dimension_;
+  double scale_ = 1;
+
+  template<typename Load>
+  [[nodiscard]] double run(Load load) const
+  {
+    std::array<double, detail::max_expression_stack> stack;
+    std::size_t top = 0;
+    for (const auto& ins : code_) {
+      switch (ins.op) {
+        case detail::expression_op::constant: stack[top++] = ins.value; break;
+        case detail::expression_op::load: stack[top++] = load(ins.index) * ins.value; break;
+        case detail::expression_op::add: --top; stack[top - 1] += stack[top]; break;
+        case detail::expression_op::subtract: --top; stack[top - 1] -= stack[top]; break;
+        case detail::expression_op::multiply: --top; stack[top - 1] *= stack[top]; break;
+        case detail::expression_op::divide: --top; stack[top - 1] /= stack[top]; break;
+      }
+    }
+    return stack[0];
+  }
+
+public:
+  compiled_expression(std::vector<detail::expression_instruction> code, std::span<const expression_variable> variables,
+                      std::size_t stack_size, packed_dimension dimension, double scale) :
+    code_(std::move(code)), variables_(variables.begin(), variables.end()), stack_size_(stack_size),
+    dimension_(dimension), scale_(scale)
+  {
+    // names are owned by the caller and are needed only while compiling
+    for (auto& v : variables_) v.name = {};
+  }
+
+  /**
+   * @brief The dimension of the result
+   */
+  [[nodiscard]] packed_dimension dimension() const noexcept { return dimension_; }
+
+  /**
+   * @brief The scale of the unit of the result (as in `dynamic_quantity::scale()`)
+   */
+  [[nodiscard]] double scale() const noexcept { return scale_; }
+
+  /**
+   * @brief The number of the instructions of the compiled program
+   */
+  [[nodiscard]] std::size_t size() const noexcept { return code_.size(); }
+
+  /**
+   * @brief Evaluates the expression for the values of the variables in their declared units
+   *
+   * @param values values of the variables in the order they were provided to `compile_expression()`
+   */
+  [[nodiscard]] dynamic_quantity operator()(std::span<const double> values) const
+  {
+    Expects(values.size() == variables_.size());
+    return dynamic_quantity(run([&](std::uint32_t i) { return values[i]; }), scale_, dimension_);
+  }
+
+  /**
+   * @brief Evaluates the expression for dynamic quantities bound to the variables
+   *
+   * @throws std::invalid_argument if a dimension of a quantity does not match its variable
+   */
+  [[nodiscard]] dynamic_quantity operator()(std::span<const dynamic_quantity> values) const
+  {
+    Expects(values.size() == variables_.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+      if (values[i].dimension() != variables_[i].dimension) detail::throw_dimension_mismatch();
+    return dynamic_quantity(run([&](std::uint32_t i) { return values[i].base_value() / variables_[i].factor; }),
+                            scale_, dimension_);
+  }
+
+  /**
+   * @brief Evaluates the expression for a batch of samples
+   *
+   * Every instruction is executed for a block of samples at once so the cost of its dispatch
+   * is shared by the whole block.
+   *
+   * @param columns values of every variable (in its declared unit) for all the samples
+   * @param result values of the expression in the unit of `scale()` for all the samples
+   */
+  void evaluate(std::span<const std::span<const double>> columns, std::span<double> result) const
+  {
+    Expects(columns.size() == variables_.size());
+    Expects(std::ranges::all_of(columns, [&](auto c) { return c.size() >= result.size(); }));
+
+    constexpr std::size_t block = 256;
+    std::vector<double> stack(stack_size_ * block);
+    for (std::size_t first = 0; first < result.size(); first += block) {
+      const std::size_t n = std::min(block, result.size() - first);
+      std::size_t top = 0;
+      for (const auto& ins : code_) {
+        double* const out = stack.data() + (ins.op <= detail::expression_op::load ? top++ : --top - 1) * block;
+        const double* const in = out + block;
+        switch (ins.op) {
+          case detail::expression_op::constant:
+            std::fill_n(out, n, ins.value);
+            break;
+          case detail::expression_op::load: {
+            const double* const v = columns[ins.index].data() + first;
+            for (std::size_t i = 0; i < n; ++i) out[i] = v[i] * ins.value;
+            break;
+          }
+          case detail::expression_op::add:
+            for (std::size_t i = 0; i < n; ++i) out[i] += in[i];
+            break;
+          case detail::expression_op::subtract:
+            for (std::size_t i = 0; i < n; ++i) out[i] -= in[i];
+            break;
+          case detail::expression_op::multiply:
+            for (std::size_t i = 0; i < n; ++i) out[i] *= in[i];
+            break;
+          case detail::expression_op::divide:
+            for (std::size_t i = 0; i < n; ++i) out[i] /= in[i];
+            break;
+        }
+      }
+      std::copy_n(stack.data(), n, result.data() + first);
+    }
+  }
+};
+
+/**
+ * @brief Compiles an expression of quantities evaluated at runtime
+ *
+ * The expression may contain numbers followed by unit symbols of the `registry` (i.e. "20 min"),
+ * variables, unit symbols alone (i.e. "distance / h"), parentheses, the unary '-', and the
+ * '+', '-', '*', '/' operators. The dimensions are checked and the unit conversion factors are
+ * folded into the program only once here.
+ *
+ * @param expr the text of the expression
+ * @param variables the variables of the expression
+ * @param result_unit a unit to express the result in (the product of the references of base
+ *        units, i.e. metre, gram, second, if not provided)
+ *
+ * @throws std::invalid_argument if the expression is malformed, contains unknown symbols, adds
+ *         quantities of different dimensions, or its dimension does not match @c result_unit
+ */
+[[nodiscard]] inline compiled_expression compile_expression(std::string_view expr,
+                                                            std::span<const expression_variable> variables = {},
+                                                            const unit_info* result_unit = nullptr)
+{
+  auto [code, stack_size, dimension] = detail::expression_parser(expr, variables).parse(result_unit);
+  return compiled_expression(std::move(code), variables, stack_size, dimension,
+                             result_unit != nullptr ? result_unit->factor : 1);
+}
+
+[[nodiscard]] inline compiled_expression compile_expression(std::string_view expr,
+                                                            std::initializer_list<expression_variable> variables,
+                                                            const unit_info* result_unit = nullptr)
+{
+  return compile_expression(expr, std::span(variables.begin(), variables.size()), result_unit);
+}
+
+}  // namespace units
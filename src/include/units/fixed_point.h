@@ -0,0 +1,280 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/integral_scaling.h>
+#include <units/customization_points.h>
+#include <units/quantity_cast.h>
+#include <units/ratio.h>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace units {
+
+namespace detail {
+
+template<typename From, typename To>
+concept non_narrowing_integral_ = // exposition only
+  std::integral<From> && std::integral<To> &&
+  std::numeric_limits<From>::digits <= std::numeric_limits<To>::digits &&
+  (std::is_signed_v<To> || !std::is_signed_v<From>);
+
+// an integral type wide enough to hold the product of two raw values of fixed-point numbers
+template<std::integral I1, std::integral I2>
+using fixed_point_wide_t =
+#ifdef __SIZEOF_INT128__
+  std::conditional_t<(std::numeric_limits<I1>::digits + std::numeric_limits<I2>::digits <
+                      std::numeric_limits<std::intmax_t>::digits), std::intmax_t, int128_t>;
+#else
+  std::intmax_t;
+#endif
+
+// rounds half away from zero
+template<std::integral Int, std::floating_point T>
+[[nodiscard]] constexpr Int round_to(T v) noexcept
+{
+  return static_cast<Int>(v < T(0) ? v - T(0.5) : v + T(0.5));
+}
+
+}  // namespace detail
+
+/**
+ * @brief A fixed-point number
+ *
+ * An integer scaled by a compile-time ratio (i.e. with @c Scale equal to @c ratio(1, 256) a raw
+ * value of @c 384 represents @c 1.5). Binary and decimal scales are supported. Used as a
+ * representation type of a quantity, a @c quantity_cast to another fixed-point representation
+ * type is computed on raw integers with the ratio of units folded into the change of scale
+ * at compile time. When the resulting raw scaling factor is @c 1 no runtime operation is done:
+ *
+ * using mm = length<millimetre, fixed_point<std::int32_t>>;
+ * using m = length<metre, fixed_point<std::int32_t, ratio(1, 1, -3)>>;
+ * m d = quantity_cast<m>(mm(1500));   // raw value 1500 is reused as is
+ *
+ * Values of fixed-point numbers with different scales are converted to the common scale of
+ * both operands before they are added, subtracted or compared. To prevent an overflow of
+ * such scaling the common representation type uses @c std::intmax_t for its raw value then.
+ *
+ * @tparam Int an integral type of the raw value
+ * @tparam Scale a value of a single unit of the raw value
+ */
+template<std::integral Int, ratio Scale = ratio(1)>
+  requires UnitRatio<Scale>
+class fixed_point {
+  Int raw_{};
+
+  template<typename T>
+  static constexpr auto inverse_scale = detail::make_conversion_factor<T>(inverse(Scale));
+
+public:
+  using value_type = Int;
+  static constexpr ratio scale = Scale;
+
+  fixed_point() = default;
+
+  template<std::integral T>
+  constexpr explicit(!is_integral(inverse(Scale)) || !detail::non_narrowing_integral_<T, Int>) fixed_point(T v) :
+      raw_(static_cast<Int>(detail::scale_by<inverse_scale<std::intmax_t>, T, std::intmax_t>(static_cast<std::intmax_t>(v))))
+  {
+  }
+
+  template<std::floating_point T>
+  constexpr explicit fixed_point(T v) : raw_(detail::round_to<Int>(v * inverse_scale<T>)) {}
+
+  template<std::integral I2, ratio S2>
+  constexpr explicit(!is_integral(S2 / Scale) || !detail::non_narrowing_integral_<I2, Int>)
+  fixed_point(const fixed_point<I2, S2>& other) :
+      raw_(static_cast<Int>(detail::scale_by<detail::make_conversion_factor<std::intmax_t>(S2 / Scale), I2, std::intmax_t>(
+        static_cast<std::intmax_t>(other.raw()))))
+  {
+  }
+
+  [[nodiscard]] static constexpr fixed_point from_raw(Int raw) noexcept
+  {
+    fixed_point fp;
+    fp.raw_ = raw;
+    return fp;
+  }
+
+  [[nodiscard]] constexpr Int raw() const noexcept { return raw_; }
+
+  template<std::floating_point T>
+  [[nodiscard]] constexpr explicit operator T() const noexcept
+  {
+    return static_cast<T>(raw_) * detail::make_conversion_factor<T>(Scale);
+  }
+
+  [[nodiscard]] constexpr fixed_point operator+() const noexcept { return *this; }
+  [[nodiscard]] constexpr fixed_point operator-() const noexcept { return from_raw(static_cast<Int>(-raw_)); }
+
+  constexpr fixed_point& operator+=(const fixed_point& rhs) noexcept
+  {
+    raw_ = static_cast<Int>(raw_ + rhs.raw_);
+    return *this;
+  }
+
+  constexpr fixed_point& operator-=(const fixed_point& rhs) noexcept
+  {
+    raw_ = static_cast<Int>(raw_ - rhs.raw_);
+    return *this;
+  }
+
+  template<std::integral T>
+  constexpr fixed_point& operator*=(const T& rhs) noexcept
+  {
+    raw_ = static_cast<Int>(raw_ * rhs);
+    return *this;
+  }
+
+  template<std::integral T>
+  constexpr fixed_point& operator/=(const T& rhs) noexcept
+  {
+    raw_ = static_cast<Int>(raw_ / rhs);
+    return *this;
+  }
+
+  // arithmetic on values of the same scale
+  [[nodiscard]] friend constexpr fixed_point operator+(const fixed_point& lhs, const fixed_point& rhs) noexcept
+  {
+    return fixed_point(lhs) += rhs;
+  }
+
+  [[nodiscard]] friend constexpr fixed_point operator-(const fixed_point& lhs, const fixed_point& rhs) noexcept
+  {
+    return fixed_point(lhs) -= rhs;
+  }
+
+  // scaling by integers
+  template<std::integral T>
+  [[nodiscard]] friend constexpr auto operator*(const fixed_point& lhs, const T& rhs) noexcept
+  {
+    using ret = fixed_point<std::common_type_t<Int, T>, Scale>;
+    return ret::from_raw(static_cast<TYPENAME ret::value_type>(lhs.raw_ * rhs));
+  }
+
+  template<std::integral T>
+  [[nodiscard]] friend constexpr auto operator*(const T& lhs, const fixed_point& rhs) noexcept
+  {
+    return rhs * lhs;
+  }
+
+  template<std::integral T>
+  [[nodiscard]] friend constexpr auto operator/(const fixed_point& lhs, const T& rhs) noexcept
+  {
+    using ret = fixed_point<std::common_type_t<Int, T>, Scale>;
+    return ret::from_raw(static_cast<TYPENAME ret::value_type>(lhs.raw_ / rhs));
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const fixed_point&, const fixed_point&) = default;
+  [[nodiscard]] friend constexpr auto operator<=>(const fixed_point&, const fixed_point&) = default;
+};
+
+// arithmetic on values of different scales
+template<std::integral I1, ratio S1, std::integral I2, ratio S2>
+  requires (!std::same_as<fixed_point<I1, S1>, fixed_point<I2, S2>>)
+[[nodiscard]] constexpr auto operator+(const fixed_point<I1, S1>& lhs, const fixed_point<I2, S2>& rhs) noexcept
+{
+  using ret = std::common_type_t<fixed_point<I1, S1>, fixed_point<I2, S2>>;
+  return ret(lhs) + ret(rhs);
+}
+
+template<std::integral I1, ratio S1, std::integral I2, ratio S2>
+  requires (!std::same_as<fixed_point<I1, S1>, fixed_point<I2, S2>>)
+[[nodiscard]] constexpr auto operator-(const fixed_point<I1, S1>& lhs, const fixed_point<I2, S2>& rhs) noexcept
+{
+  using ret = std::common_type_t<fixed_point<I1, S1>, fixed_point<I2, S2>>;
+  return ret(lhs) - ret(rhs);
+}
+
+template<std::integral I1, ratio S1, std::integral I2, ratio S2>
+  requires (!std::same_as<fixed_point<I1, S1>, fixed_point<I2, S2>>)
+[[nodiscard]] constexpr bool operator==(const fixed_point<I1, S1>& lhs, const fixed_point<I2, S2>& rhs) noexcept
+{
+  using ct = std::common_type_t<fixed_point<I1, S1>, fixed_point<I2, S2>>;
+  return ct(lhs) == ct(rhs);
+}
+
+template<std::integral I1, ratio S1, std::integral I2, ratio S2>
+  requires (!std::same_as<fixed_point<I1, S1>, fixed_point<I2, S2>>)
+[[nodiscard]] constexpr auto operator<=>(const fixed_point<I1, S1>& lhs, const fixed_point<I2, S2>& rhs) noexcept
+{
+  using ct = std::common_type_t<fixed_point<I1, S1>, fixed_point<I2, S2>>;
+  return ct(lhs) <=> ct(rhs);
+}
+
+// multiplication and division in the common scale of both operands computed on raw values widened to prevent
+// an overflow of the intermediate product and to preserve the fractional bits of the quotient
+template<std::integral I1, ratio S1, std::integral I2, ratio S2>
+[[nodiscard]] constexpr auto operator*(const fixed_point<I1, S1>& lhs, const fixed_point<I2, S2>& rhs) noexcept
+{
+  using ret = fixed_point<std::common_type_t<I1, I2>, common_ratio(S1, S2)>;
+  using wide = detail::fixed_point_wide_t<I1, I2>;
+  constexpr detail::integral_factor factor = detail::make_integral_factor(S1 * S2 / ret::scale);
+  const wide product = static_cast<wide>(lhs.raw()) * static_cast<wide>(rhs.raw());
+  return ret::from_raw(static_cast<TYPENAME ret::value_type>(product * static_cast<wide>(factor.multiplier) /
+                                                             static_cast<wide>(factor.divisor)));
+}
+
+template<std::integral I1, ratio S1, std::integral I2, ratio S2>
+[[nodiscard]] constexpr auto operator/(const fixed_point<I1, S1>& lhs, const fixed_point<I2, S2>& rhs) noexcept
+{
+  using ret = fixed_point<std::common_type_t<I1, I2>, common_ratio(S1, S2)>;
+  using wide = detail::fixed_point_wide_t<I1, I2>;
+  constexpr detail::integral_factor factor = detail::make_integral_factor(S1 / (S2 * ret::scale));
+  const wide dividend = static_cast<wide>(lhs.raw()) * static_cast<wide>(factor.multiplier);
+  return ret::from_raw(static_cast<TYPENAME ret::value_type>(dividend / (static_cast<wide>(rhs.raw()) *
+                                                                         static_cast<wide>(factor.divisor))));
+}
+
+template<std::integral Int, ratio Scale>
+struct quantity_values<fixed_point<Int, Scale>> {
+  static constexpr fixed_point<Int, Scale> zero() noexcept { return fixed_point<Int, Scale>::from_raw(0); }
+  static constexpr fixed_point<Int, Scale> one() noexcept
+    requires (is_integral(inverse(Scale)))
+  {
+    return fixed_point<Int, Scale>(1);
+  }
+  static constexpr fixed_point<Int, Scale> min() noexcept { return fixed_point<Int, Scale>::from_raw(std::numeric_limits<Int>::lowest()); }
+  static constexpr fixed_point<Int, Scale> max() noexcept { return fixed_point<Int, Scale>::from_raw(std::numeric_limits<Int>::max()); }
+};
+
+}  // namespace units
+
+template<std::integral I1, units::ratio S1, std::integral I2, units::ratio S2>
+struct std::common_type<units::fixed_point<I1, S1>, units::fixed_point<I2, S2>> {
+  using type = units::fixed_point<std::conditional_t<S1 == S2, std::common_type_t<I1, I2>, std::intmax_t>,
+                                  units::common_ratio(S1, S2)>;
+};
+
+template<std::integral Int, units::ratio Scale, std::floating_point T>
+struct std::common_type<units::fixed_point<Int, Scale>, T> {
+  using type = T;
+};
+
+template<std::floating_point T, std::integral Int, units::ratio Scale>
+struct std::common_type<T, units::fixed_point<Int, Scale>> {
+  using type = T;
+};
@@ -24,6 +24,10 @@
 
 #include <units/customization_points.h>
 #include <units/quantity.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
 #include <string_view>
 
 #ifdef _MSC_VER
@@ -60,24 +64,26 @@
 // -   Add the new symbol in the `units_types` variable in the `parse_units_format` function
 // -   Add a new case in the `if` following the format_error in `parse_units_format` function;
 //     this should invoke `handler.on_[...]`
-// -   Edit `fmt::formatter`:
+// -   Add a new `format_segment::kind` enumerator for it
+// -   Edit `quantity_formatter`:
 //     - Add a new field for the flag/specs
-//     - Add to the `fmt::formatter::spec_handler` a `on_[...]` function that set the flag/specs if needed
+//     - Add to the `quantity_formatter::spec_handler` a `on_[...]` function that set the flag/specs if needed
+//       and records the new segment
 // -   Edit `units_formatter`:
-//     - Add a new field for the flag/specs
 //     - write a `on_[...]` function that writes to the `out` iterator the correct output
+//     - dispatch the new segment kind in `units_formatter::on_segment`
 // 
 // If you want to add a new `units-rep-type`:
 // -   Add the new symbol in the `valid_rep_types` variable (which is in the
-//         fmt::formatter::spec_handler::on_type member function)
+//         quantity_formatter::spec_handler::on_type member function)
 //     NB: currently this function forward the modifier to the value that must be formatted;
 //         if the symbol has no meaning for fmt::formatter<Rep>, this behavior should be disabled manually
 //         (as is done for '\0')
-// -   Implement the effect of the new flag in `format_units_quantity_value`
+// -   Implement the effect of the new flag in `parse_rep_formatter`
 // 
 // If you want to add a new `units-unit-modifier`:
 // -   Add the new symbol in the `valid_modifiers` variable (which is in the
-//         fmt::formatter::spec_handler::on_modifier member function)
+//         quantity_formatter::spec_handler::on_modifier member function)
 // -   Implement the effect of the new flag in the `units_formatter::on_quantity_unit` member function
 
 namespace units {
@@ -109,6 +115,46 @@ namespace units {
       char modifier = '\0';
     };
 
+    // Static storage for the characters produced by `%n`, `%t` and the default format
+    // so that they can be referred to by the pre-tokenized `format_segment`s
+    template<typename CharT, char C>
+    inline constexpr CharT char_literal = static_cast<CharT>(C);
+
+    // One pre-tokenized piece of a `units-specs` (literal text, `%Q` or `%q`)
+    template<typename CharT>
+    struct format_segment {
+      enum class kind : unsigned char { text, quantity_value, quantity_unit };
+
+      kind type = kind::text;
+      const CharT* begin = nullptr;
+      const CharT* end = nullptr;
+    };
+
+    // Result of parsing `units-specs` once in `fmt::formatter::parse()`
+    //
+    // Format strings with more conversion-specs/literals than `capacity` are flagged as
+    // `overflow` and are walked again with `parse_units_format` at format time.
+    template<typename CharT>
+    struct format_segments {
+      static constexpr std::size_t capacity = 16;
+
+      std::array<format_segment<CharT>, capacity> data{};
+      std::size_t size = 0;
+      bool overflow = false;
+
+      constexpr void push_back(const format_segment<CharT>& s)
+      {
+        if (size < capacity)
+          data[size++] = s;
+        else
+          overflow = true;
+      }
+
+      [[nodiscard]] constexpr bool empty() const { return size == 0 && !overflow; }
+      [[nodiscard]] constexpr auto begin() const { return data.begin(); }
+      [[nodiscard]] constexpr auto end() const { return data.begin() + size; }
+    };
+
     // Parse a `units-rep-modifier`
     template <typename CharT, typename Handler>
     constexpr const CharT* parse_units_rep(const CharT* begin, const CharT* end, Handler&& handler, bool treat_as_floating_point)
@@ -183,12 +229,12 @@ namespace units {
           handler.on_text(ptr - 1, ptr);
           break;
         case 'n': {
-          const char newline[] = "\n";
+          const CharT* newline = &char_literal<CharT, '\n'>;
           handler.on_text(newline, newline + 1);
           break;
         }
         case 't': {
-          const char tab[] = "\t";
+          const CharT* tab = &char_literal<CharT, '\t'>;
           handler.on_text(tab, tab + 1);
           break;
         }
@@ -212,299 +258,388 @@ namespace units {
       return ptr;
     }
 
-    // build the 'representation' as requested in the format string, applying only units-rep-modifiers
-    template<typename CharT, typename Rep, typename OutputIt, typename LocaleRef>
-    inline OutputIt format_units_quantity_value(OutputIt out, const Rep& val, const rep_format_specs& rep_specs, LocaleRef loc)
+    // configure `fmt::formatter<Rep>` once with the units-rep-modifiers
+    // (i.e. "%+.2Q" is parsed as "{:+.2f}" would be)
+    template<typename Rep, typename CharT>
+    constexpr void parse_rep_formatter(fmt::formatter<Rep, CharT>& f, const rep_format_specs& rep_specs)
     {
-      fmt::basic_memory_buffer<CharT> buffer;
-      auto to_buffer = std::back_inserter(buffer);
+      // [sign] [#] [.precision] [type] [L]
+      CharT spec[16] = {};
+      CharT* ptr = spec;
 
-      fmt::format_to(to_buffer, "{{:");
       switch(rep_specs.sign) {
       case fmt::sign::none:
         break;
       case fmt::sign::plus:
-        format_to(to_buffer, "+");
+        *ptr++ = '+';
         break;
       case fmt::sign::minus:
-        format_to(to_buffer, "-");
+        *ptr++ = '-';
         break;
       case fmt::sign::space:
-        format_to(to_buffer, " ");
+        *ptr++ = ' ';
         break;
       }
 
       if (rep_specs.alt) {
-        format_to(to_buffer, "#");
+        *ptr++ = '#';
       }
       auto type = rep_specs.type;
       if (auto precision = rep_specs.precision; precision >= 0) {
-        format_to(to_buffer, ".{}{}", precision, type == '\0' ? 'f' : type);
+        *ptr++ = '.';
+        CharT digits[10] = {};
+        int count = 0;
+        do {
+          digits[count++] = static_cast<CharT>('0' + precision % 10);
+          precision /= 10;
+        } while (precision > 0);
+        while (count > 0) {
+          *ptr++ = digits[--count];
+        }
+        *ptr++ = type == '\0' ? 'f' : type;
       } else if constexpr (treat_as_floating_point<Rep>) {
-        format_to(to_buffer, "{}", type == '\0' ? 'g' : type);
+        *ptr++ = type == '\0' ? 'g' : type;
       } else {
         if (type != '\0') {
-          format_to(to_buffer, "{}", type);
+          *ptr++ = type;
         }
       }
       if (rep_specs.use_locale) {
-        format_to(to_buffer, "L");
+        *ptr++ = 'L';
       }
-      fmt::format_to(to_buffer, "}}");
-      if (rep_specs.use_locale and static_cast<bool>(loc)) {
-        return format_to(out, loc.template get<std::locale>(), fmt::to_string(buffer), val);
+
+      fmt::basic_format_parse_context<CharT> ctx(fmt::basic_string_view<CharT>(spec, fmt::detail::to_unsigned(ptr - spec)));
+      f.parse(ctx);
+    }
+
+    // the width (in code points) of a formatted text
+    template<typename CharT>
+    [[nodiscard]] constexpr std::size_t code_points(const CharT* begin, const CharT* end)
+    {
+      if constexpr (sizeof(CharT) == 1) {
+        // do not count UTF-8 continuation bytes
+        return static_cast<std::size_t>(std::count_if(begin, end, [](CharT c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; }));
+      } else {
+        return static_cast<std::size_t>(end - begin);
+      }
+    }
+
+    template<typename OutputIt, typename CharT>
+    OutputIt write_fill(OutputIt out, const fmt::detail::fill_t<CharT>& fill, std::size_t n)
+    {
+      for (; n > 0; --n) {
+        out = std::copy(fill.data(), fill.data() + fill.size(), out);
       }
-      return format_to(out, fmt::to_string(buffer), val);
+      return out;
     }
 
-    template<typename OutputIt, typename Dimension, typename Unit, typename Rep, typename LocaleRef, typename CharT>
+    // writes the quantity according to the pre-parsed specs directly to the `out` iterator
+    template<typename OutputIt, typename Rep, typename RepFormatter, typename FormatContext, typename CharT>
     struct units_formatter {
       OutputIt out;
-      Rep val;
-      global_format_specs<CharT> const & global_specs;
-      rep_format_specs const & rep_specs;
+      const Rep& val;
+      RepFormatter& rep_formatter;
+      std::string_view standard_symbol;
+      std::string_view ascii_symbol;
       unit_format_specs const & unit_specs;
-      LocaleRef loc;
-
-      explicit units_formatter(
-        OutputIt o, quantity<Dimension, Unit, Rep> q,
-        global_format_specs<CharT> const & gspecs,
-        rep_format_specs const & rspecs, unit_format_specs const & uspecs,
-        LocaleRef lc
-      ):
-        out(o), val(q.count()), global_specs(gspecs), rep_specs(rspecs), unit_specs(uspecs), loc(lc)
-      {
-      }
+      FormatContext& ctx;
 
       template<typename CharT2>
       void on_text(const CharT2* begin, const CharT2* end)
       {
-        std::copy(begin, end, out);
+        out = std::copy(begin, end, out);
       }
 
       void on_quantity_value([[maybe_unused]] const CharT*, [[maybe_unused]] const CharT*)
       {
-        out = format_units_quantity_value<CharT>(out, val, rep_specs, loc);
+        if constexpr (std::same_as<OutputIt, typename FormatContext::iterator>) {
+          ctx.advance_to(out);
+          out = rep_formatter.format(val, ctx);
+        } else {
+          // i.e. formatting into a buffer to be padded
+          fmt::basic_format_context<OutputIt, CharT> value_ctx(out, {}, ctx.locale());
+          out = rep_formatter.format(val, value_ctx);
+        }
       }
 
       void on_quantity_unit([[maybe_unused]] const CharT)
       {
-        auto txt = unit_text<Dimension, Unit>();
-        if(unit_specs.modifier == 'A') {
-          format_to(out, "{}", txt.ascii().c_str());
-        }
-        else {
-          format_to(out, "{}", txt.standard().c_str());
+        const auto symbol = unit_specs.modifier == 'A' ? ascii_symbol : standard_symbol;
+        out = std::copy(symbol.begin(), symbol.end(), out);
+      }
+
+      void on_segment(const format_segment<CharT>& s)
+      {
+        switch (s.type) {
+        case format_segment<CharT>::kind::text:
+          on_text(s.begin, s.end);
+          break;
+        case format_segment<CharT>::kind::quantity_value:
+          on_quantity_value(s.begin, s.end);
+          break;
+        case format_segment<CharT>::kind::quantity_unit:
+          on_quantity_unit('q');
+          break;
         }
       }
     };
 
-  }  // namespace detail
+    // Formats a quantity given its representation value and unit symbols
+    //
+    // Shared by all the quantities having the same representation type, so that each
+    // `fmt::formatter<quantity<D, U, Rep>>` is only a thin shim providing the unit symbol.
+    template<typename Rep, typename CharT>
+    class quantity_formatter {
+    private:
+      // inline capacity of the buffer of the content of a padded quantity
+      static constexpr std::size_t padded_content_size = 128;
+
+      using iterator = TYPENAME fmt::basic_format_parse_context<CharT>::iterator;
+      using arg_ref_type = fmt::detail::arg_ref<CharT>;
+      using segment = format_segment<CharT>;
+
+      global_format_specs<CharT> global_specs;
+      rep_format_specs  rep_specs;
+      unit_format_specs unit_specs;
+      format_segments<CharT> segments;
+      fmt::formatter<Rep, CharT> rep_formatter;
+      bool quantity_value = false;
+      bool quantity_unit = false;
+      arg_ref_type width_ref;
+      arg_ref_type precision_ref;
+      fmt::basic_string_view<CharT> format_str;
+
+      struct spec_handler {
+        quantity_formatter& f;
+        fmt::basic_format_parse_context<CharT>& context;
+        fmt::basic_string_view<CharT> format_str;
+
+        template<typename Id>
+        constexpr arg_ref_type make_arg_ref(Id arg_id)
+        {
+          context.check_arg_id(arg_id);
+          return arg_ref_type(arg_id);
+        }
 
-}  // namespace units
+        constexpr arg_ref_type make_arg_ref(fmt::basic_string_view<CharT> arg_id)
+        {
+          context.check_arg_id(arg_id);
+          return arg_ref_type(arg_id);
+        }
 
-template<typename Dimension, typename Unit, typename Rep, typename CharT>
-struct fmt::formatter<units::quantity<Dimension, Unit, Rep>, CharT> {
-private:
-  using quantity = units::quantity<Dimension, Unit, Rep>;
-  using iterator = TYPENAME fmt::basic_format_parse_context<CharT>::iterator;
-  using arg_ref_type = fmt::detail::arg_ref<CharT>;
-
-  units::detail::global_format_specs<CharT> global_specs;
-  units::detail::rep_format_specs  rep_specs;
-  units::detail::unit_format_specs unit_specs;
-  bool quantity_value = false;
-  bool quantity_unit = false;
-  bool quantity_unit_ascii_only = false;
-  arg_ref_type width_ref;
-  arg_ref_type precision_ref;
-  fmt::basic_string_view<CharT> format_str;
-
-  struct spec_handler {
-    formatter& f;
-    fmt::basic_format_parse_context<CharT>& context;
-    fmt::basic_string_view<CharT> format_str;
-
-    template<typename Id>
-    constexpr arg_ref_type make_arg_ref(Id arg_id)
-    {
-      context.check_arg_id(arg_id);
-      return arg_ref_type(arg_id);
-    }
+        constexpr arg_ref_type make_arg_ref(fmt::detail::auto_id)
+        {
+          return arg_ref_type(context.next_arg_id());
+        }
 
-    constexpr arg_ref_type make_arg_ref(fmt::basic_string_view<CharT> arg_id)
-    {
-      context.check_arg_id(arg_id);
-      return arg_ref_type(arg_id);
-    }
+        void on_error(const char* msg) { throw fmt::format_error(msg); }
+        constexpr void on_fill(fmt::basic_string_view<CharT> fill) { f.global_specs.fill = fill; }    // global
+        constexpr void on_align(fmt::align_t align)           { f.global_specs.align = align; }  // global
+        constexpr void on_width(int width)                    { f.global_specs.width = width; }  // global
+        constexpr void on_plus()  { f.rep_specs.sign = fmt::sign::plus; }     // rep
+        constexpr void on_minus() { f.rep_specs.sign = fmt::sign::minus; }    // rep
+        constexpr void on_space() { f.rep_specs.sign = fmt::sign::space; }    // rep
+        constexpr void on_alt()   { f.rep_specs.alt  = true; }                // rep
+        constexpr void on_precision(int precision) { f.rep_specs.precision = precision; } // rep
+        constexpr void on_locale() { f.rep_specs.use_locale = true; }         // rep
+        constexpr void on_type(char type)                                     // rep
+        {
+          constexpr auto valid_rep_types = std::string_view{"aAbBdeEfFgGoxX"};
+          if (valid_rep_types.find(type) != std::string_view::npos) {
+            f.rep_specs.type = type;
+          } else {
+            on_error("invalid quantity type specifier");
+          }
+        }
+        constexpr void on_modifier(char mod) {
+          constexpr auto valid_modifiers = std::string_view{"A"};
+          if (valid_modifiers.find(mod) != std::string_view::npos) {
+            f.unit_specs.modifier = mod;
+          } else {
+            on_error("invalid unit modifier specified");
+          }
+        } // unit
+        constexpr void end_precision() {}
 
-    constexpr arg_ref_type make_arg_ref(fmt::detail::auto_id)
-    {
-      return arg_ref_type(context.next_arg_id());
-    }
+        template<typename Id>
+        constexpr void on_dynamic_width(Id arg_id)
+        {
+          f.width_ref = make_arg_ref(arg_id);
+        }
 
-    void on_error(const char* msg) { throw fmt::format_error(msg); }
-    constexpr void on_fill(basic_string_view<CharT> fill) { f.global_specs.fill = fill; }    // global
-    constexpr void on_align(align_t align)                { f.global_specs.align = align; }  // global
-    constexpr void on_width(int width)                    { f.global_specs.width = width; }  // global
-    constexpr void on_plus()  { f.rep_specs.sign = fmt::sign::plus; }     // rep
-    constexpr void on_minus() { f.rep_specs.sign = fmt::sign::minus; }    // rep
-    constexpr void on_space() { f.rep_specs.sign = fmt::sign::space; }    // rep
-    constexpr void on_alt()   { f.rep_specs.alt  = true; }                // rep
-    constexpr void on_precision(int precision) { f.rep_specs.precision = precision; } // rep
-    constexpr void on_locale() { f.rep_specs.use_locale = true; }         // rep
-    constexpr void on_type(char type)                                     // rep
-    {
-      constexpr auto valid_rep_types = std::string_view{"aAbBdeEfFgGoxX"};
-      if (valid_rep_types.find(type) != std::string_view::npos) {
-        f.rep_specs.type = type;
-      } else {
-        on_error("invalid quantity type specifier");
-      }
-    }
-    constexpr void on_modifier(char mod) {
-      constexpr auto valid_modifiers = std::string_view{"A"};
-      if (valid_modifiers.find(mod) != std::string_view::npos) {
-        f.unit_specs.modifier = mod;
-      } else {
-        on_error("invalid unit modifier specified");
-      }
-    } // unit
-    constexpr void end_precision() {}
+        template<typename Id>
+        constexpr void on_dynamic_precision(Id arg_id)
+        {
+          f.precision_ref = make_arg_ref(arg_id);
+        }
 
-    template<typename Id>
-    constexpr void on_dynamic_width(Id arg_id)
-    {
-      f.width_ref = make_arg_ref(arg_id);
-    }
+        constexpr void on_text(const CharT* begin, const CharT* end)
+        {
+          f.segments.push_back({segment::kind::text, begin, end});
+        }
+        constexpr void on_quantity_value(const CharT* begin, const CharT* end)
+        {
+          if (begin != end) {
+            parse_units_rep(begin, end, *this, units::treat_as_floating_point<Rep>);
+          }
+          f.quantity_value = true;
+          f.segments.push_back({segment::kind::quantity_value});
+        }
+        constexpr void on_quantity_unit(const CharT mod)
+        {
+          if (mod != 'q') {
+            f.unit_specs.modifier = mod;
+          }
+          f.quantity_unit = true;
+          f.segments.push_back({segment::kind::quantity_unit});
+        }
 
-    template<typename Id>
-    constexpr void on_dynamic_precision(Id arg_id)
-    {
-      f.precision_ref = make_arg_ref(arg_id);
-    }
+      };
 
-    constexpr void on_text(const CharT*, const CharT*) {}
-    constexpr void on_quantity_value(const CharT* begin, const CharT* end)
-    {
-      if (begin != end) {
-        units::detail::parse_units_rep(begin, end, *this, units::treat_as_floating_point<Rep>);
+      struct parse_range {
+        iterator begin;
+        iterator end;
+      };
+
+      constexpr parse_range do_parse(fmt::basic_format_parse_context<CharT>& ctx)
+      {
+        auto begin = ctx.begin(), end = ctx.end();
+        if(begin == end || *begin == '}')
+          return {begin, begin};
+
+        // handler to assign parsed data to formatter data members
+        spec_handler handler{*this, ctx, format_str};
+
+        // parse alignment
+        begin = fmt::detail::parse_align(begin, end, handler);
+        if(begin == end)
+          return {begin, begin};
+
+        // parse width
+        begin = fmt::detail::parse_width(begin, end, handler);
+        if(begin == end)
+          return {begin, begin};
+
+        // parse units-specific specification
+        end = parse_units_format(begin, end, handler);
+
+        if(global_specs.align == fmt::align_t::none && (!quantity_unit || quantity_value))
+          // quantity values should behave like numbers (by default aligned to right)
+          global_specs.align = fmt::align_t::right;
+
+        return {begin, end};
       }
-      f.quantity_value = true;
-    }
-    constexpr void on_quantity_unit(const CharT mod)
-    {
-      if (mod != 'q') {
-        f.unit_specs.modifier = mod;
+
+      [[nodiscard]] constexpr bool dynamic_precision() const
+      {
+        return precision_ref.kind != fmt::detail::arg_id_kind::none;
       }
-      f.quantity_unit = true;
-    }
 
-  };
+      template<typename OutputIt, typename RepFormatter, typename FormatContext>
+      OutputIt format_quantity_content(OutputIt out, const Rep& val, std::string_view standard_symbol, std::string_view ascii_symbol,
+                                       RepFormatter& rep_fmt, FormatContext& ctx) const
+      {
+        units_formatter<OutputIt, Rep, RepFormatter, FormatContext, CharT> f{
+          out, val, rep_fmt, standard_symbol, ascii_symbol, unit_specs, ctx};
+
+        if(segments.empty()) {
+          // default format should print value followed by the unit separated with 1 space
+          f.on_quantity_value(nullptr, nullptr);
+          if(!standard_symbol.empty()) {
+            const CharT* space = &char_literal<CharT, ' '>;
+            f.on_text(space, space + 1);
+            f.on_quantity_unit('q');
+          }
+        }
+        else if(segments.overflow) {
+          // user provided format too long to be pre-tokenized
+          parse_units_format(format_str.begin(), format_str.end(), f);
+        }
+        else {
+          // user provided format
+          for(const auto& s : segments)
+            f.on_segment(s);
+        }
+        return f.out;
+      }
 
-  struct parse_range {
-    iterator begin;
-    iterator end;
-  };
+      template<typename RepFormatter, typename FormatContext>
+      auto format_quantity(const Rep& val, std::string_view standard_symbol, std::string_view ascii_symbol,
+                           RepFormatter& rep_fmt, int width, FormatContext& ctx) const
+      {
+        if(width <= 0)
+          return format_quantity_content(ctx.out(), val, standard_symbol, ascii_symbol, rep_fmt, ctx);
+
+        // apply global specs: format the content once into a stack buffer (growing on the heap
+        // only for an unusually long output) to measure it and pad it around
+        fmt::basic_memory_buffer<CharT, padded_content_size> content;
+        format_quantity_content(std::back_inserter(content), val, standard_symbol, ascii_symbol, rep_fmt, ctx);
+        const auto size = code_points(content.data(), content.data() + content.size());
+        const auto padding = static_cast<std::size_t>(width) > size ? static_cast<std::size_t>(width) - size : 0;
+        std::size_t left_padding = 0;
+        switch(global_specs.align) {
+        case fmt::align_t::right:
+          left_padding = padding;
+          break;
+        case fmt::align_t::center:
+          left_padding = padding / 2;
+          break;
+        default:
+          break;
+        }
 
-  constexpr parse_range do_parse(fmt::basic_format_parse_context<CharT>& ctx)
-  {
-    auto begin = ctx.begin(), end = ctx.end();
-    if(begin == end || *begin == '}')
-      return {begin, begin};
+        auto out = write_fill(ctx.out(), global_specs.fill, left_padding);
+        out = std::copy(content.data(), content.data() + content.size(), out);
+        return write_fill(out, global_specs.fill, padding - left_padding);
+      }
 
-    // handler to assign parsed data to formatter data members
-    spec_handler handler{*this, ctx, format_str};
+    public:
+      constexpr auto parse(fmt::basic_format_parse_context<CharT>& ctx)
+      {
+        auto range = do_parse(ctx);
+        format_str = fmt::basic_string_view<CharT>(&*range.begin, fmt::detail::to_unsigned(range.end - range.begin));
+        if(!dynamic_precision())
+          parse_rep_formatter(rep_formatter, rep_specs);
+        return range.end;
+      }
 
-    // parse alignment
-    begin = fmt::detail::parse_align(begin, end, handler);
-    if(begin == end)
-      return {begin, begin};
+      template<typename FormatContext>
+      auto format(const Rep& val, std::string_view standard_symbol, std::string_view ascii_symbol, FormatContext& ctx) const
+      {
+        // process dynamic width and precision
+        int width = global_specs.width;
+        fmt::detail::handle_dynamic_spec<fmt::detail::width_checker>(width, width_ref, ctx);
+
+        if(dynamic_precision()) {
+          // the only case where the representation specs cannot be resolved in `parse()`
+          rep_format_specs specs = rep_specs;
+          fmt::detail::handle_dynamic_spec<fmt::detail::precision_checker>(specs.precision, precision_ref, ctx);
+          fmt::formatter<Rep, CharT> rep_fmt;
+          parse_rep_formatter(rep_fmt, specs);
+          return format_quantity(val, standard_symbol, ascii_symbol, rep_fmt, width, ctx);
+        }
 
-    // parse width
-    begin = fmt::detail::parse_width(begin, end, handler);
-    if(begin == end)
-      return {begin, begin};
+        // `fmt::formatter<Rep>::format()` is not `const` in all {fmt} versions
+        auto rep_fmt = rep_formatter;
+        return format_quantity(val, standard_symbol, ascii_symbol, rep_fmt, width, ctx);
+      }
+    };
 
-    // parse units-specific specification
-    end = units::detail::parse_units_format(begin, end, handler);
+  }  // namespace detail
 
-    if(global_specs.align == fmt::align_t::none && (!quantity_unit || quantity_value))
-      // quantity values should behave like numbers (by default aligned to right)
-      global_specs.align = fmt::align_t::right;
+}  // namespace units
 
-    return {begin, end};
-  }
+template<typename Dimension, typename Unit, typename Rep, typename CharT>
+struct fmt::formatter<units::quantity<Dimension, Unit, Rep>, CharT> : units::detail::quantity_formatter<Rep, CharT> {
+private:
+  static constexpr auto symbol = units::detail::unit_text<Dimension, Unit>();
 
 public:
-  constexpr auto parse(fmt::basic_format_parse_context<CharT>& ctx)
-  {
-    auto range = do_parse(ctx);
-    format_str = fmt::basic_string_view<CharT>(&*range.begin, fmt::detail::to_unsigned(range.end - range.begin));
-    return range.end;
-  }
-
   template<typename FormatContext>
-  auto format(const units::quantity<Dimension, Unit, Rep>& q, FormatContext& ctx)
+  auto format(const units::quantity<Dimension, Unit, Rep>& q, FormatContext& ctx) const
   {
-    auto begin = format_str.begin(), end = format_str.end();
-
-    // process dynamic width and precision
-    fmt::detail::handle_dynamic_spec<fmt::detail::width_checker>(global_specs.width, width_ref, ctx);
-    fmt::detail::handle_dynamic_spec<fmt::detail::precision_checker>(rep_specs.precision, precision_ref, ctx);
-
-    // In `global_format_buffer` we will create a global format string
-    //  e.g. "{:*^10%.1Q_%q}, 1.23_q_m" => "{:*^10}"
-    fmt::basic_memory_buffer<CharT> global_format_buffer;
-    auto to_gfb = std::back_inserter(global_format_buffer);
-    format_to(to_gfb, "{{:");
-    if (global_specs.fill.size() != 1 || global_specs.fill[0] != ' ') {
-      format_to(to_gfb, "{}", global_specs.fill.data());
-    }
-    if (auto align = global_specs.align; align != fmt::align_t::none) {
-      switch (align) {
-      case fmt::align_t::left:
-        format_to(to_gfb, "<");
-        break;
-      case fmt::align_t::right:
-        format_to(to_gfb, ">");
-        break;
-      case fmt::align_t::center:
-        format_to(to_gfb, "^");
-        break;
-      default:
-        break;
-      }
-    }
-    if (auto width = global_specs.width; width >= 1) {
-      format_to(to_gfb, "{}", width);
-    }
-    format_to(to_gfb, "}}");
-
-    // In `quantity_buffer` we will have the representation and the unit formatted according to their
-    //  specification, ignoring global specifiers
-    //  e.g. "{:*^10%.1Q_%q}, 1.23_q_m" => "1.2_m"
-    // TODO Avoid extra copying if width is not specified
-    fmt::basic_memory_buffer<CharT> quantity_buffer;
-    auto to_quantity_buffer = std::back_inserter(quantity_buffer);
-
-    // deal with quantity content
-    if(begin == end || *begin == '}') {
-      // default format should print value followed by the unit separated with 1 space
-      to_quantity_buffer = units::detail::format_units_quantity_value<CharT>(to_quantity_buffer, q.count(), rep_specs, ctx.locale());
-      constexpr auto symbol = units::detail::unit_text<Dimension, Unit>();
-      if(symbol.standard().size()) {
-        *to_quantity_buffer++ = CharT(' ');
-        format_to(to_quantity_buffer, "{}", symbol.standard().c_str());
-      }
-    }
-    else {
-      // user provided format
-      units::detail::units_formatter f(to_quantity_buffer, q, global_specs, rep_specs, unit_specs, ctx.locale());
-      parse_units_format(begin, end, f);
-    }
-    // Format the `quantity buffer` using specs from `global_format_buffer`
-    // In the example, equivalent to fmt::format("{:*^10}", "1.2_m")
-    return format_to(ctx.out(), fmt::to_string(global_format_buffer), fmt::to_string(quantity_buffer));
+    return units::detail::quantity_formatter<Rep, CharT>::format(q.count(),
+      std::string_view(symbol.standard().c_str(), symbol.standard().size()),
+      std::string_view(symbol.ascii().c_str(), symbol.ascii().size()), ctx);
   }
 };
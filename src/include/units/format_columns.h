@@ -0,0 +1,110 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/format.h>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+namespace units {
+
+/**
+ * @brief Specification of the text produced by `format_columns()`
+ */
+struct columns_format {
+  std::string_view value_spec = "%Q";  ///< units-format-spec applied to every value (without braces)
+  std::string_view delimiter = ",";    ///< text put between the columns
+  bool header = true;                  ///< emit a first row with the unit symbol of each column
+};
+
+namespace detail {
+
+template<typename Buffer>
+void append(Buffer& out, std::string_view txt)
+{
+  out.append(txt.data(), txt.data() + txt.size());
+}
+
+}  // namespace detail
+
+/**
+ * @brief Writes ranges of quantities as delimited text columns
+ *
+ * Each range becomes one column and each element a cell of a row that is terminated with
+ * a new line. Rows are written until the shortest range is exhausted.
+ *
+ * The unit symbol of each column is known at compile time and is written only once in the
+ * header row. The format specification is parsed only once per column and its resolved
+ * formatter is reused for all of the values of that column.
+ *
+ * @param out the buffer to append the text to
+ * @param spec format of the columns
+ * @param ranges ranges of quantities to be written as columns
+ */
+template<std::size_t SIZE, typename Allocator, std::ranges::input_range... Ranges>
+  requires (sizeof...(Ranges) > 0) && (Quantity<std::ranges::range_value_t<Ranges>> && ...)
+void format_columns(fmt::basic_memory_buffer<char, SIZE, Allocator>& out, const columns_format& spec, Ranges&&... ranges)
+{
+  using context = fmt::buffer_context<char>;
+  using indices = std::index_sequence_for<Ranges...>;
+
+  if(spec.header) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+      (..., (I == 0 ? void() : detail::append(out, spec.delimiter),
+             [&]<typename Q>(std::type_identity<Q>) {
+               constexpr auto symbol = detail::unit_text<typename Q::dimension, typename Q::unit>();
+               detail::append(out, std::string_view(symbol.standard().c_str(), symbol.standard().size()));
+             }(std::type_identity<std::ranges::range_value_t<Ranges>>{})));
+    }(indices{});
+    out.push_back('\n');
+  }
+
+  // resolve the format specification once per column
+  std::tuple<fmt::formatter<std::ranges::range_value_t<Ranges>, char>...> formatters;
+  std::apply([&](auto&... f) {
+    (..., [&] {
+      fmt::format_parse_context parse_ctx(fmt::string_view(spec.value_spec.data(), spec.value_spec.size()));
+      f.parse(parse_ctx);
+    }());
+  }, formatters);
+
+  context ctx(typename context::iterator(out), {});
+  std::tuple its{std::ranges::begin(ranges)...};
+  const std::tuple ends{std::ranges::end(ranges)...};
+  while([&]<std::size_t... I>(std::index_sequence<I...>) {
+    return (... && (std::get<I>(its) != std::get<I>(ends)));
+  }(indices{})) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+      (..., (I == 0 ? void() : detail::append(out, spec.delimiter),
+             static_cast<void>(std::get<I>(formatters).format(*std::get<I>(its), ctx)),
+             ++std::get<I>(its)));
+    }(indices{});
+    out.push_back('\n');
+  }
+}
+
+}  // namespace units
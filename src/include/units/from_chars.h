@@ -0,0 +1,282 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/fnv1a.h>
+#include <units/bits/integral_scaling.h>
+#include <units/bits/registry_units.h>
+#include <units/bits/unit_text.h>
+#include <units/quantity_cast.h>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+
+namespace units {
+
+namespace detail {
+
+// characters that may be a part of a word of a unit symbol (all non-ASCII ones included as they
+// are UTF-8 sequences of symbols like 'µ', '²' or '·'); a symbol may contain also other characters
+// (i.e. "s^-1" or "J K^-1") but it may not end with a character followed by one of these
+[[nodiscard]] constexpr bool is_unit_symbol_char(char c) noexcept
+{
+  const auto uc = static_cast<unsigned char>(c);
+  return uc >= 0x80 || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+         c == '/' || c == '^' || c == '*' || c == '_';
+}
+
+/**
+ * @brief Compile-time perfect hash table of the unit symbols of a dimension
+ *
+ * Maps both the standard and the ASCII symbols of every unit to the index of the first unit
+ * with that symbol and ratio in @c Units. The seed of the FNV-1a hash is searched at compile time so that each symbol
+ * occupies a different slot and the lookup is a single hash and comparison.
+ */
+template<Dimension D, Unit... Units>
+class unit_symbol_table {
+  static constexpr std::size_t max_symbols = 2 * sizeof...(Units);
+
+  struct entry {
+    std::string_view symbol;
+    std::size_t index = 0;
+  };
+
+  struct table {
+    std::array<entry, max_symbols> entries{};
+    std::size_t size = 0;
+    std::size_t max_length = 0;
+    std::uint64_t basis = fnv1a_offset_basis;
+    int shift = 64;
+    std::array<std::size_t, 4 * max_symbols> slots{};  // 1-based index into `entries`, 0 for an empty slot
+  };
+
+  static CONSTEVAL int slot_bits()
+  {
+    int bits = 1;
+    while((std::size_t{1} << bits) < 2 * max_symbols) ++bits;
+    return bits;
+  }
+
+  // bits of FNV-1a depend only on the same and lower bits of the input so the hash is spread
+  // with a Fibonacci hashing step and its top bits are used
+  [[nodiscard]] static constexpr std::size_t slot_of(std::string_view symbol, std::uint64_t basis, int shift)
+  {
+    return static_cast<std::size_t>((fnv1a(symbol, basis) * 0x9E3779B97F4A7C15ULL) >> shift);
+  }
+
+  static CONSTEVAL table make_table()
+  {
+    table t;
+    const std::array<std::string_view, max_symbols> symbols = {
+      std::string_view(unit_text_v<D, Units>.standard().c_str(), unit_text_v<D, Units>.standard().size())...,
+      std::string_view(unit_text_v<D, Units>.ascii().c_str(), unit_text_v<D, Units>.ascii().size())...
+    };
+    const std::array<ratio, sizeof...(Units)> ratios = {Units::ratio...};
+    for(std::size_t i = 0; i < max_symbols; ++i) {
+      const entry e{symbols[i], i % sizeof...(Units)};
+      bool duplicate = false;
+      for(std::size_t j = 0; j < t.size; ++j) {
+        if(t.entries[j].symbol == e.symbol) {
+          if(ratios[t.entries[j].index] != ratios[e.index])
+            throw std::invalid_argument("ambiguous unit symbol");
+          duplicate = true;
+        }
+      }
+      if(!duplicate) {
+        t.entries[t.size++] = e;
+        if(e.symbol.size() > t.max_length) t.max_length = e.symbol.size();
+      }
+    }
+
+    t.shift = 64 - slot_bits();
+    for(std::uint64_t seed = 0;; ++seed) {
+      t.basis = fnv1a_offset_basis ^ seed;
+      t.slots = {};
+      bool collision = false;
+      for(std::size_t i = 0; i < t.size && !collision; ++i) {
+        auto& slot = t.slots[slot_of(t.entries[i].symbol, t.basis, t.shift)];
+        if(slot != 0)
+          collision = true;
+        else
+          slot = i + 1;
+      }
+      if(!collision) return t;
+    }
+  }
+
+  static constexpr table table_ = make_table();
+
+public:
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  /**
+   * @brief The length of the longest symbol
+   */
+  static constexpr std::size_t max_length = table_.max_length;
+
+  /**
+   * @brief Returns the index of the unit having the provided symbol or @c npos if not found
+   */
+  [[nodiscard]] static constexpr std::size_t find(std::string_view symbol)
+  {
+    const auto slot = table_.slots[slot_of(symbol, table_.basis, table_.shift)];
+    if(slot == 0 || table_.entries[slot - 1].symbol != symbol) return npos;
+    return table_.entries[slot - 1].index;
+  }
+};
+
+// the largest magnitude `n` for which `n * f.multiplier / f.divisor` does not exceed `limit`
+[[nodiscard]] constexpr std::uint64_t max_unscaled_magnitude(std::uint64_t limit, const integral_factor& f)
+{
+  const auto m = static_cast<std::uint64_t>(f.multiplier);
+  const auto d = static_cast<std::uint64_t>(f.divisor);
+  const auto rec = make_wide_reciprocal(d);
+  const auto fits = [&](std::uint64_t n) {
+    const std::uint64_t hi = umulh(n, m);
+    return hi < d && divide(hi, n * m, rec) <= limit;
+  };
+
+  std::uint64_t lo = 0;
+  std::uint64_t hi = std::numeric_limits<std::uint64_t>::max();
+  if(fits(hi)) return hi;
+  while(hi - lo > 1) {
+    const std::uint64_t mid = lo + (hi - lo) / 2;
+    (fits(mid) ? lo : hi) = mid;
+  }
+  return lo;
+}
+
+// the range of values in the unit U that can be converted to Q without an overflow of its representation type
+template<typename Rep>
+struct unscaled_range {
+  Rep min;
+  Rep max;
+};
+
+template<Quantity Q, typename U>
+[[nodiscard]] consteval auto unscaled_range_of()
+{
+  using rep = TYPENAME Q::rep;
+  using limits = std::numeric_limits<rep>;
+  constexpr ratio r = cast_ratio(quantity<typename Q::dimension, U, rep>(), Q());
+  if constexpr (std::integral<rep> && limits::digits <= 64 && has_integral_factor(r)) {
+    constexpr integral_factor f = make_integral_factor(r);
+    const std::uint64_t max = std::min(max_unscaled_magnitude(static_cast<std::uint64_t>(limits::max()), f),
+                                       static_cast<std::uint64_t>(limits::max()));
+    if constexpr (std::signed_integral<rep>) {
+      const std::uint64_t min_magnitude = static_cast<std::uint64_t>(limits::max()) + 1;
+      const std::uint64_t min = std::min(max_unscaled_magnitude(min_magnitude, f), min_magnitude);
+      return unscaled_range<rep>{static_cast<rep>(-static_cast<rep>(min - 1) - 1), static_cast<rep>(max)};
+    }
+    else {
+      return unscaled_range<rep>{0, static_cast<rep>(max)};
+    }
+  }
+  else {
+    return unscaled_range<rep>{limits::lowest(), limits::max()};
+  }
+}
+
+template<Quantity Q, typename Units>
+struct quantity_parser;
+
+template<Quantity Q, typename... Units>
+struct quantity_parser<Q, registry_units<typename Q::dimension, Units...>> {
+  using rep = TYPENAME Q::rep;
+  using table = unit_symbol_table<typename Q::dimension, typename Q::unit, Units...>;
+  static constexpr std::array<Q (*)(const rep&), 1 + sizeof...(Units)> converters = {
+    &convert_from<Q, typename Q::unit>, &convert_from<Q, Units>...};
+  static constexpr std::array<unscaled_range<rep>, 1 + sizeof...(Units)> ranges = {
+    unscaled_range_of<Q, typename Q::unit>(), unscaled_range_of<Q, Units>()...};
+
+  static std::from_chars_result parse(const char* first, const char* last, Q& q)
+  {
+    rep value;
+    const auto res = std::from_chars(first, last, value);
+    if(res.ec != std::errc()) return res;
+
+    auto ptr = res.ptr;
+    if(ptr != last && *ptr == ' ' && ptr + 1 != last && is_unit_symbol_char(ptr[1])) ++ptr;
+
+    // the longest symbol that is not followed by a character of the same word
+    const auto symbol_begin = ptr;
+    const auto symbol_end =
+      static_cast<std::size_t>(last - symbol_begin) > table::max_length ? symbol_begin + table::max_length : last;
+    for(auto end = symbol_end; end != symbol_begin; --end) {
+      if(end != last && is_unit_symbol_char(*end) && is_unit_symbol_char(end[-1])) continue;
+      const auto index = table::find(std::string_view(symbol_begin, static_cast<std::size_t>(end - symbol_begin)));
+      if(index != table::npos) {
+        if(value < ranges[index].min || ranges[index].max < value) return {end, std::errc::result_out_of_range};
+        const Q converted = converters[index](value);
+        if constexpr (std::floating_point<rep>) {
+          if(std::isinf(converted.count())) return {end, std::errc::result_out_of_range};
+        }
+        q = converted;
+        return {end, std::errc()};
+      }
+    }
+    return {first, std::errc::invalid_argument};
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Parses a quantity from a character sequence
+ *
+ * Parses a number with `std::from_chars()` followed by an optional space and a unit symbol
+ * (i.e. "12.5 km/h") and converts it to the quantity type @c Q.
+ *
+ * The symbol is looked up among the standard and ASCII symbols of the unit of @c Q and of
+ * the accepted @c Units with a compile-time generated perfect hash. The longest symbol at the
+ * beginning of the rest of the input is matched so symbols may contain spaces or other
+ * characters (i.e. "J K^-1"). Only units of the dimension of @c Q can be provided so the
+ * dimensional compatibility is verified at compile time.
+ *
+ * All the units of the dimension of @c Q registered in the `registry` are accepted by
+ * `from_chars_registered()` provided in `units/from_chars_registered.h`.
+ *
+ * @tparam Q quantity type to parse
+ * @tparam Units additional units of the same dimension accepted in the input
+ *
+ * @return `std::from_chars_result` with `ptr` pointing to the first character not matching
+ *         the pattern or with `ec` set to `std::errc::invalid_argument` if the number or
+ *         the unit symbol is not recognized (`ptr` is @c first then) and
+ *         `std::errc::result_out_of_range` if the number or its value converted to the unit
+ *         of @c Q does not fit in `Q::rep` (@c q is not modified then).
+ */
+template<Quantity Q, UnitOf<typename Q::dimension>... Units>
+  requires requires(const char* ptr, typename Q::rep& v) { std::from_chars(ptr, ptr, v); }
+std::from_chars_result from_chars(const char* first, const char* last, Q& q)
+{
+  return detail::quantity_parser<Q, detail::registry_units<typename Q::dimension, Units...>>::parse(first, last, q);
+}
+
+}  // namespace units
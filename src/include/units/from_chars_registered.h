@@ -0,0 +1,71 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/bits/registered_units.h>
+#include <units/from_chars.h>
+
+namespace units {
+
+namespace detail {
+
+// true if a value expressed in the unit U can be converted to Q
+template<Quantity Q, typename U>
+inline constexpr bool convertible_from_unit =
+  treat_as_floating_point<typename Q::rep> ||
+  has_integral_factor(cast_ratio(quantity<typename Q::dimension, U, typename Q::rep>(), Q()));
+
+// the registered units (as `registry_units<D, Us...>`) that a value of Q can be converted from
+template<Quantity Q, typename Units>
+struct convertible_units;
+
+template<Quantity Q, typename... Units>
+struct convertible_units<Q, registry_units<typename Q::dimension, Units...>> :
+    registry_units_join<typename Q::dimension, registry_units<typename Q::dimension>,
+                        conditional<convertible_from_unit<Q, Units>, registry_units<typename Q::dimension, Units>,
+                                    registry_units<typename Q::dimension>>...> {};
+
+}  // namespace detail
+
+/**
+ * @brief Parses a quantity expressed in any registered unit of its dimension
+ *
+ * Works as `from_chars()` accepting all the units of the dimension of @c Q registered in the
+ * `registry` (`registered_units` in `units/bits/registered_units.h`) that the representation type
+ * of @c Q can be converted from.
+ *
+ * This header includes all the systems of units of the registry so it may not be used in the same
+ * translation unit with the ones redefining their units (i.e. `si::international` or `si::imperial`).
+ *
+ * @tparam Q quantity type to parse
+ */
+template<Quantity Q>
+  requires requires(const char* ptr, typename Q::rep& v) { std::from_chars(ptr, ptr, v); }
+std::from_chars_result from_chars_registered(const char* first, const char* last, Q& q)
+{
+  using units_type = TYPENAME detail::convertible_units<Q, detail::registered_units_of<typename Q::dimension>>::type;
+  return detail::quantity_parser<Q, units_type>::parse(first, last, q);
+}
+
+}  // namespace units
@@ -0,0 +1,125 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/bits/fnv1a.h>
+#include <units/quantity_point.h>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
+namespace units {
+
+namespace detail {
+
+template<Exponent E>
+[[nodiscard]] consteval std::uint64_t exponent_id(std::uint64_t basis)
+{
+  using dim = TYPENAME E::dimension;
+  std::uint64_t hash = fnv1a(std::string_view(dim::symbol.c_str(), dim::symbol.size()), basis);
+  const auto& unit_symbol = dim::base_unit::symbol.ascii();
+  hash = fnv1a(std::string_view(unit_symbol.c_str(), unit_symbol.size()), hash);
+  hash = fnv1a(E::num, hash);
+  return fnv1a(E::den, hash);
+}
+
+template<typename... Es>
+[[nodiscard]] consteval std::uint64_t exponent_list_id(exponent_list<Es...>)
+{
+  std::uint64_t hash = fnv1a(static_cast<std::intmax_t>(sizeof...(Es)));
+  ((hash = exponent_id<Es>(hash)), ...);
+  return hash;
+}
+
+template<Dimension D>
+[[nodiscard]] consteval std::uint64_t dimension_id_impl()
+{
+  if constexpr (BaseDimension<D>)
+    return exponent_list_id(exponent_list<exponent<D, 1>>());
+  else
+    return exponent_list_id(typename D::exponents());
+}
+
+template<Dimension D, UnitOf<D> U>
+[[nodiscard]] consteval std::uint64_t unit_id_impl()
+{
+  std::uint64_t hash = fnv1a(U::ratio.num, dimension_id_impl<D>());
+  hash = fnv1a(U::ratio.den, hash);
+  return fnv1a(U::ratio.exp, hash);
+}
+
+[[nodiscard]] constexpr std::size_t hash_combine(std::size_t seed, std::size_t value) noexcept
+{
+  return seed ^ (value + 0x9E3779B9 + (seed << 6) + (seed >> 2));
+}
+
+}  // namespace detail
+
+/**
+ * @brief A stable 64-bit identifier of a dimension
+ *
+ * Computed at compile time from the canonical list of exponents of base dimensions (their
+ * symbols, symbols of their base units, and the values of exponents), so it does not depend
+ * on the name of the dimension type, the compiler, or the platform. Equivalent dimensions
+ * (i.e. a named derived dimension and the `unknown_dimension` with the same exponents) have
+ * the same identifier.
+ *
+ * @tparam D a dimension to identify
+ */
+template<Dimension D>
+inline constexpr std::uint64_t dimension_id = detail::dimension_id_impl<D>();
+
+/**
+ * @brief A stable 64-bit identifier of a unit of a dimension
+ *
+ * Computed at compile time from the `dimension_id` of @c D and the ratio of the unit to the
+ * coherent unit of the dimension.
+ *
+ * @tparam D a dimension of the unit
+ * @tparam U a unit to identify
+ */
+template<Dimension D, UnitOf<D> U>
+inline constexpr std::uint64_t unit_id = detail::unit_id_impl<D, U>();
+
+}  // namespace units
+
+template<typename D, typename U, typename Rep>
+  requires requires(const Rep& v) { { std::hash<Rep>{}(v) } -> std::convertible_to<std::size_t>; }
+struct std::hash<units::quantity<D, U, Rep>> {
+  [[nodiscard]] std::size_t operator()(const units::quantity<D, U, Rep>& q) const
+  {
+    return units::detail::hash_combine(static_cast<std::size_t>(units::unit_id<D, U>), std::hash<Rep>{}(q.count()));
+  }
+};
+
+template<typename D, typename U, typename Rep, typename Origin>
+  requires requires(const Rep& v) { { std::hash<Rep>{}(v) } -> std::convertible_to<std::size_t>; }
+struct std::hash<units::quantity_point<D, U, Rep, Origin>> {
+  [[nodiscard]] std::size_t operator()(const units::quantity_point<D, U, Rep, Origin>& qp) const
+  {
+    return std::hash<units::quantity<D, U, Rep>>{}(qp.relative());
+  }
+};
@@ -0,0 +1,168 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/quantity.h>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace units {
+
+namespace detail {
+
+template<Quantity Q, bool Negative>
+struct lazy_term {
+  using quantity_type = Q;
+  Q q;
+
+  template<Quantity To>
+  [[nodiscard]] constexpr typename To::rep accumulate(const typename To::rep& acc) const
+  {
+    if constexpr (Negative)
+      return acc - quantity_cast<To>(q).count();
+    else
+      return acc + quantity_cast<To>(q).count();
+  }
+};
+
+template<typename T>
+struct negated_term;
+
+template<Quantity Q, bool Negative>
+struct negated_term<lazy_term<Q, Negative>> {
+  using type = lazy_term<Q, !Negative>;
+};
+
+}  // namespace detail
+
+/**
+ * @brief A deferred sum of quantities
+ *
+ * Created with @c lazy() and extended with @c operator+ and @c operator-. Contrary to the eager
+ * arithmetic on quantities, where every intermediate result is scaled to a common unit of its
+ * two operands, the common unit of all the terms is computed only once at compile time and every
+ * term is scaled to it exactly once when the sum is evaluated.
+ *
+ * @tparam Terms terms of the sum
+ */
+template<typename... Terms>
+class lazy_sum {
+  std::tuple<Terms...> terms_;
+
+public:
+  using quantity_type = std::common_type_t<typename Terms::quantity_type...>;
+  using dimension = typename quantity_type::dimension;
+  using unit = typename quantity_type::unit;
+  using rep = typename quantity_type::rep;
+
+  constexpr explicit lazy_sum(const Terms&... terms) : terms_(terms...) {}
+  constexpr explicit lazy_sum(const std::tuple<Terms...>& terms) : terms_(terms) {}
+
+  [[nodiscard]] constexpr const std::tuple<Terms...>& terms() const { return terms_; }
+
+  [[nodiscard]] constexpr quantity_type eval() const { return eval_impl(std::index_sequence_for<Terms...>()); }
+  [[nodiscard]] constexpr operator quantity_type() const { return eval(); }
+
+  [[nodiscard]] constexpr auto operator+() const { return *this; }
+  [[nodiscard]] constexpr auto operator-() const
+  {
+    return lazy_sum<typename detail::negated_term<Terms>::type...>(negate(std::index_sequence_for<Terms...>()));
+  }
+
+  template<typename... Ts>
+  [[nodiscard]] friend constexpr auto operator+(const lazy_sum& lhs, const lazy_sum<Ts...>& rhs)
+    requires QuantityEquivalentTo<typename lazy_sum<Ts...>::quantity_type, quantity_type>
+  {
+    return lazy_sum<Terms..., Ts...>(std::tuple_cat(lhs.terms(), rhs.terms()));
+  }
+
+  template<typename... Ts>
+  [[nodiscard]] friend constexpr auto operator-(const lazy_sum& lhs, const lazy_sum<Ts...>& rhs)
+    requires QuantityEquivalentTo<typename lazy_sum<Ts...>::quantity_type, quantity_type>
+  {
+    return lhs + (-rhs);
+  }
+
+  template<QuantityEquivalentTo<quantity_type> Q>
+  [[nodiscard]] friend constexpr auto operator+(const lazy_sum& lhs, const Q& rhs)
+  {
+    return lhs + lazy_sum<detail::lazy_term<Q, false>>({rhs});
+  }
+
+  template<QuantityEquivalentTo<quantity_type> Q>
+  [[nodiscard]] friend constexpr auto operator+(const Q& lhs, const lazy_sum& rhs)
+  {
+    return lazy_sum<detail::lazy_term<Q, false>>({lhs}) + rhs;
+  }
+
+  template<QuantityEquivalentTo<quantity_type> Q>
+  [[nodiscard]] friend constexpr auto operator-(const lazy_sum& lhs, const Q& rhs)
+  {
+    return lhs + lazy_sum<detail::lazy_term<Q, true>>({rhs});
+  }
+
+  template<QuantityEquivalentTo<quantity_type> Q>
+  [[nodiscard]] friend constexpr auto operator-(const Q& lhs, const lazy_sum& rhs)
+  {
+    return lazy_sum<detail::lazy_term<Q, false>>({lhs}) - rhs;
+  }
+
+private:
+  template<std::size_t... Is>
+  [[nodiscard]] constexpr auto negate(std::index_sequence<Is...>) const
+  {
+    return std::tuple<typename detail::negated_term<Terms>::type...>(typename detail::negated_term<Terms>::type{std::get<Is>(terms_).q}...);
+  }
+
+  template<std::size_t... Is>
+  [[nodiscard]] constexpr quantity_type eval_impl(std::index_sequence<Is...>) const
+  {
+    rep result{};
+    ((result = std::get<Is>(terms_).template accumulate<quantity_type>(result)), ...);
+    return quantity_type(result);
+  }
+};
+
+/**
+ * @brief Starts a deferred sum of quantities
+ *
+ * Sums and differences of quantities started with @c lazy() scale each term to their common unit
+ * only once. For example:
+ *
+ * Length auto l = (units::lazy(1_q_km) + 2_q_m + 3_q_mm + 4_q_um).eval();   // 1'002'003'004 um
+ *
+ * The same applies to dot-product-like expressions as the eager multiplication of quantities
+ * never scales its operands:
+ *
+ * Energy auto e = (units::lazy(f1 * d1) + f2 * d2 + f3 * d3).eval();
+ */
+template<Quantity Q>
+[[nodiscard]] constexpr lazy_sum<detail::lazy_term<Q, false>> lazy(const Q& q)
+{
+  return lazy_sum<detail::lazy_term<Q, false>>({q});
+}
+
+}  // namespace units
@@ -0,0 +1,410 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#if __has_include(<sys/mman.h>)
+
+#include <units/dynamic_quantity.h>
+#include <units/quantity_cast.h>
+#include <units/quantity_span.h>
+#include <units/ratio.h>
+#include <units/serialize.h>
+#include <gsl/gsl_assert>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace units {
+
+namespace detail {
+
+// file layout: 64 bytes of a header followed by the values of quantities
+//   [0, 8)   magic "mp-units"
+//   [8, 16)  format version
+//   [16, 24) exponents of the dimension (`packed_dimension::bits()`)
+//   [24, 48) ratio of the unit to the product of the reference units of base dimensions (num, den, exp)
+//   [48, 49) kind of the representation type ('i' - signed, 'u' - unsigned, 'f' - floating-point)
+//   [49, 50) size of the representation type
+// all the numbers are little-endian
+inline constexpr std::array<char, 8> series_magic = {'m', 'p', '-', 'u', 'n', 'i', 't', 's'};
+inline constexpr std::uint64_t series_version = 2;
+inline constexpr std::size_t series_header_size = 64;
+
+struct series_header {
+  std::uint64_t dimension;
+  ratio unit;
+  char rep_kind;
+  std::uint8_t rep_size;
+
+  [[nodiscard]] friend constexpr bool operator==(const series_header&, const series_header&) = default;
+};
+
+template<Quantity Q>
+[[nodiscard]] constexpr series_header series_header_of()
+{
+  using rep = TYPENAME Q::rep;
+  return {packed_dimension::of<typename Q::dimension>().bits(), quantity_ratio(Q()), wire_rep_kind<rep>,
+          static_cast<std::uint8_t>(sizeof(rep))};
+}
+
+[[nodiscard]] inline std::array<std::byte, series_header_size> encode(const series_header& h)
+{
+  std::array<std::byte, series_header_size> buf{};
+  auto out = buf.data();
+  for (const char c : series_magic) *out++ = static_cast<std::byte>(c);
+  out = store_le(series_version, out);
+  out = store_le(h.dimension, out);
+  out = store_le(h.unit.num, out);
+  out = store_le(h.unit.den, out);
+  out = store_le(h.unit.exp, out);
+  *out++ = static_cast<std::byte>(h.rep_kind);
+  *out = static_cast<std::byte>(h.rep_size);
+  return buf;
+}
+
+[[nodiscard]] inline series_header decode(const std::byte* in)
+{
+  for (const char c : series_magic)
+    if (*in++ != static_cast<std::byte>(c)) throw std::runtime_error("not a quantity series file");
+  if (load_le<std::uint64_t>(in) != series_version) throw std::runtime_error("unsupported quantity series file version");
+  const auto dimension = load_le<std::uint64_t>(in + 8);
+  const auto num = load_le<std::intmax_t>(in + 16);
+  const auto den = load_le<std::intmax_t>(in + 24);
+  const auto exp = load_le<std::intmax_t>(in + 32);
+  if (num <= 0 || den <= 0) throw std::runtime_error("invalid unit ratio in a quantity series file");
+  return {dimension, ratio(num, den, exp), static_cast<char>(in[40]), std::to_integer<std::uint8_t>(in[41])};
+}
+
+// verifies that the header of a file can be read as the quantity Q (of any system of units)
+template<Quantity Q>
+void check_compatible(const series_header& h)
+{
+  constexpr series_header expected = series_header_of<Q>();
+  if (h.dimension != expected.dimension) throw std::runtime_error("incompatible dimension of a quantity series file");
+  if (h.rep_kind != expected.rep_kind || h.rep_size != expected.rep_size)
+    throw std::runtime_error("incompatible representation type of a quantity series file");
+}
+
+[[noreturn]] inline void throw_errno(const char* what)
+{
+  throw std::system_error(errno, std::generic_category(), what);
+}
+
+class file_descriptor {
+  int fd_ = -1;
+public:
+  file_descriptor(const std::filesystem::path& path, int flags, mode_t mode = 0) : fd_(::open(path.c_str(), flags, mode))
+  {
+    if (fd_ == -1) throw_errno("open");
+  }
+  file_descriptor(file_descriptor&& other) noexcept : fd_(std::exchange(other.fd_, -1)) {}
+  file_descriptor& operator=(file_descriptor&& other) noexcept
+  {
+    std::swap(fd_, other.fd_);
+    return *this;
+  }
+  ~file_descriptor()
+  {
+    if (fd_ != -1) ::close(fd_);
+  }
+
+  [[nodiscard]] int get() const noexcept { return fd_; }
+
+  [[nodiscard]] std::size_t size() const
+  {
+    struct stat st;
+    if (::fstat(fd_, &st) == -1) throw_errno("fstat");
+    return static_cast<std::size_t>(st.st_size);
+  }
+};
+
+[[nodiscard]] inline long double to_long_double(const ratio& r)
+{
+  long double factor = static_cast<long double>(r.num) / static_cast<long double>(r.den);
+  for (auto e = r.exp; e > 0; --e) factor *= 10;
+  for (auto e = r.exp; e < 0; ++e) factor /= 10;
+  return factor;
+}
+
+}  // namespace detail
+
+/**
+ * @brief A read-only memory-mapped file of a series of quantities
+ *
+ * Maps a file written with `series_writer` and provides the zero-copy access to its values.
+ * The header of the file records the exponents of the dimension (`packed_dimension`), the ratio
+ * of the unit, and the representation type of the stored quantities.
+ *
+ * A file written in any unit of the dimension of @c Q, also in another system of units
+ * (i.e. a `si::length` file read as `cgs::length`), can be opened. If the unit differs
+ * from the one of @c Q the values are converted on access with `operator[]`, and
+ * `quantities()` (the zero-copy view) is available only when `same_unit()` is true.
+ *
+ * @tparam Q a quantity type to read
+ */
+template<RepLayoutQuantity Q>
+  requires detail::wire_rep<typename Q::rep> && requires { packed_dimension::of<typename Q::dimension>(); }
+class mapped_series {
+  static_assert(std::endian::native == std::endian::little, "quantity series files are little-endian");
+
+public:
+  using quantity_type = Q;
+  using rep = TYPENAME Q::rep;
+
+  /**
+   * @brief Maps the file
+   *
+   * @throws std::system_error if the file cannot be opened or mapped
+   * @throws std::runtime_error if the file is not a quantity series file or its dimension or
+   *         representation type does not match @c Q, or for an integral representation type if
+   *         the ratio of the units cannot be expressed as an integral multiplier and divisor
+   */
+  explicit mapped_series(const std::filesystem::path& path)
+  {
+    const detail::file_descriptor fd(path, O_RDONLY);
+    size_bytes_ = fd.size();
+    if (size_bytes_ < detail::series_header_size) throw std::runtime_error("not a quantity series file");
+
+    void* addr = ::mmap(nullptr, size_bytes_, PROT_READ, MAP_SHARED, fd.get(), 0);
+    if (addr == MAP_FAILED) detail::throw_errno("mmap");
+    data_ = static_cast<const std::byte*>(addr);
+
+    try {
+      const auto header = detail::decode(data_);
+      detail::check_compatible<Q>(header);
+      unit_ratio_ = header.unit;
+      const ratio r = unit_ratio_ / detail::quantity_ratio(Q());
+      if constexpr (std::is_floating_point_v<rep>) {
+        factor_ = detail::to_long_double(r);
+      }
+      else {
+        if (!detail::has_integral_factor(r))
+          throw std::runtime_error("quantity series file unit not convertible to an integral representation type");
+        const detail::integral_factor f = detail::make_integral_factor(r);
+        factor_ = detail::make_runtime_scale(static_cast<std::uint64_t>(f.multiplier), static_cast<std::uint64_t>(f.divisor));
+      }
+    } catch (...) {
+      ::munmap(const_cast<std::byte*>(data_), size_bytes_);
+      throw;
+    }
+    same_unit_ = unit_ratio_ == detail::quantity_ratio(Q());
+  }
+
+  mapped_series(mapped_series&& other) noexcept :
+    data_(std::exchange(other.data_, nullptr)), size_bytes_(std::exchange(other.size_bytes_, 0)),
+    unit_ratio_(other.unit_ratio_), factor_(other.factor_), same_unit_(other.same_unit_)
+  {
+  }
+
+  mapped_series& operator=(mapped_series other) noexcept
+  {
+    std::swap(data_, other.data_);
+    std::swap(size_bytes_, other.size_bytes_);
+    std::swap(unit_ratio_, other.unit_ratio_);
+    std::swap(factor_, other.factor_);
+    std::swap(same_unit_, other.same_unit_);
+    return *this;
+  }
+
+  ~mapped_series()
+  {
+    if (data_) ::munmap(const_cast<std::byte*>(data_), size_bytes_);
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return (size_bytes_ - detail::series_header_size) / sizeof(rep); }
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+  /**
+   * @brief Ratio of the unit the file was written in to the product of the reference units of
+   *        base dimensions (i.e. metre, gram, second)
+   */
+  [[nodiscard]] ratio unit_ratio() const noexcept { return unit_ratio_; }
+
+  /**
+   * @brief Returns true if the file was written in the unit of @c Q
+   */
+  [[nodiscard]] bool same_unit() const noexcept { return same_unit_; }
+
+  /**
+   * @brief Values as written to the file (in the unit returned by `unit_ratio()`)
+   */
+  [[nodiscard]] std::span<const rep> reps() const noexcept
+  {
+    return {reinterpret_cast<const rep*>(data_ + detail::series_header_size), size()};
+  }
+
+  /**
+   * @brief Zero-copy view of the quantities
+   *
+   * @note Requires `same_unit()`
+   */
+  [[nodiscard]] quantity_span<const Q> quantities() const
+  {
+    Expects(same_unit());
+    return as_quantities<Q>(reps());
+  }
+
+  /**
+   * @brief Returns the quantity at the index @c i converted to the unit of @c Q
+   *
+   * Integral values are scaled exactly (truncated toward zero as with `quantity_cast()`).
+   */
+  [[nodiscard]] Q operator[](std::size_t i) const
+  {
+    const rep v = reps()[i];
+    if (same_unit_) return Q(v);
+    if constexpr (std::is_floating_point_v<rep>)
+      return Q(static_cast<rep>(static_cast<long double>(v) * factor_));
+    else
+      return Q(detail::scale_integral(v, factor_));
+  }
+
+private:
+  const std::byte* data_ = nullptr;
+  std::size_t size_bytes_ = 0;
+  ratio unit_ratio_{1};
+  std::conditional_t<std::is_floating_point_v<rep>, long double, detail::runtime_scale> factor_{};
+  bool same_unit_ = true;
+};
+
+/**
+ * @brief Appends quantities to a series file to be read with `mapped_series`
+ *
+ * Creates the file with a header describing @c Q or, if the file already exists, verifies
+ * that it was written for exactly the same quantity type and appends to it. Values are
+ * buffered and written with the `flush()` call, when the buffer is full, and on destruction.
+ *
+ * @tparam Q a quantity type to write
+ */
+template<RepLayoutQuantity Q>
+  requires detail::wire_rep<typename Q::rep> && requires { packed_dimension::of<typename Q::dimension>(); }
+class series_writer {
+  static_assert(std::endian::native == std::endian::little, "quantity series files are little-endian");
+
+public:
+  using quantity_type = Q;
+  using rep = TYPENAME Q::rep;
+
+  static constexpr std::size_t buffer_capacity = 64 * 1024 / sizeof(rep);
+
+  /**
+   * @brief Opens the file for appending
+   *
+   * @throws std::system_error if the file cannot be opened or written
+   * @throws std::runtime_error if the existing file was written for a different quantity type
+   */
+  explicit series_writer(const std::filesystem::path& path) : fd_(path, O_RDWR | O_CREAT | O_APPEND, 0644)
+  {
+    constexpr detail::series_header header = detail::series_header_of<Q>();
+    const auto size = fd_.size();
+    if (size == 0) {
+      const auto buf = detail::encode(header);
+      write(buf.data(), buf.size());
+    } else {
+      std::array<std::byte, detail::series_header_size> buf;
+      if (size < buf.size() || ::pread(fd_.get(), buf.data(), buf.size(), 0) != static_cast<ssize_t>(buf.size()))
+        throw std::runtime_error("not a quantity series file");
+      const auto existing = detail::decode(buf.data());
+      detail::check_compatible<Q>(existing);
+      if (existing != header) throw std::runtime_error("quantity series file written in a different unit");
+      if ((size - buf.size()) % sizeof(rep) != 0) throw std::runtime_error("truncated quantity series file");
+    }
+    buffer_.reserve(buffer_capacity);
+  }
+
+  series_writer(series_writer&&) = default;
+  series_writer& operator=(series_writer&&) = default;
+
+  ~series_writer()
+  {
+    try {
+      flush();
+    } catch (...) {
+    }
+  }
+
+  void append(const Q& q)
+  {
+    buffer_.push_back(q.count());
+    if (buffer_.size() == buffer_capacity) flush();
+  }
+
+  void append(std::span<const Q> qs)
+  {
+    if (buffer_.size() + qs.size() > buffer_capacity) {
+      flush();
+      if (qs.size() >= buffer_capacity) {
+        const auto reps = as_reps(qs);
+        write(reps.data(), reps.size_bytes());
+        return;
+      }
+    }
+    for (const Q& q : qs) buffer_.push_back(q.count());
+  }
+
+  /**
+   * @brief Writes the buffered values to the file
+   */
+  void flush()
+  {
+    if (buffer_.empty()) return;
+    write(buffer_.data(), buffer_.size() * sizeof(rep));
+    buffer_.clear();
+  }
+
+private:
+  detail::file_descriptor fd_;
+  std::vector<rep> buffer_;
+
+  void write(const void* data, std::size_t size)
+  {
+    auto ptr = static_cast<const char*>(data);
+    while (size > 0) {
+      const auto res = ::write(fd_.get(), ptr, size);
+      if (res == -1) {
+        if (errno == EINTR) continue;
+        detail::throw_errno("write");
+      }
+      ptr += res;
+      size -= static_cast<std::size_t>(res);
+    }
+  }
+};
+
+}  // namespace units
+
+#endif  // __has_include(<sys/mman.h>)
@@ -24,28 +24,58 @@
 
 #include <units/one_rep.h>
 #include <units/physical/dimensions/thermodynamic_temperature.h>
+#include <units/point_origin.h>
 #include <units/quantity.h>
+#include <units/quantity_point.h>
 
 namespace units::physical::si {
 
 struct kelvin : named_unit<kelvin, "K", no_prefix> {};
+struct degree_celsius : alias_unit<kelvin, basic_symbol_text{"°C", "deg_C"}, no_prefix> {};
 
 struct dim_thermodynamic_temperature : physical::dim_thermodynamic_temperature<kelvin> {};
 
 template<UnitOf<dim_thermodynamic_temperature> U, QuantityValue Rep = double>
 using thermodynamic_temperature = quantity<dim_thermodynamic_temperature, U, Rep>;
 
+// the origin of the Celsius scale (the absolute zero is the `zero_origin` of kelvins)
+struct ice_point : point_origin<zero_origin, kelvin, ratio(27'315, 100)> {};
+
+}  // namespace units::physical::si
+
+namespace units {
+
+template<>
+struct default_point_origin<physical::si::degree_celsius> {
+  using type = physical::si::ice_point;
+};
+
+}  // namespace units
+
+namespace units::physical::si {
+
+template<QuantityValue Rep = double>
+using kelvin_point = quantity_point<dim_thermodynamic_temperature, kelvin, Rep>;
+
+template<QuantityValue Rep = double>
+using celsius_point = quantity_point<dim_thermodynamic_temperature, degree_celsius, Rep, ice_point>;
+
 inline namespace literals {
 
 // K
 constexpr auto operator"" _q_K(unsigned long long l) { return thermodynamic_temperature<kelvin, std::int64_t>(l); }
 constexpr auto operator"" _q_K(long double l) { return thermodynamic_temperature<kelvin, long double>(l); }
 
+// deg_C
+constexpr auto operator"" _q_deg_C(unsigned long long l) { return thermodynamic_temperature<degree_celsius, std::int64_t>(l); }
+constexpr auto operator"" _q_deg_C(long double l) { return thermodynamic_temperature<degree_celsius, long double>(l); }
+
 }  // namespace literals
 
 namespace unit_constants {
 
 inline constexpr auto K = thermodynamic_temperature<kelvin, one_rep>{};
+inline constexpr auto deg_C = thermodynamic_temperature<degree_celsius, one_rep>{};
 
 }  // namespace unit_constants
 
@@ -0,0 +1,66 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/physical/si/base/thermodynamic_temperature.h>
+
+namespace units::physical::si::us {
+
+// https://www.nist.gov/pml/special-publication-811/nist-guide-si-appendix-b-conversion-factors#B9
+struct degree_fahrenheit : named_scaled_unit<degree_fahrenheit, basic_symbol_text{"°F", "deg_F"}, no_prefix, ratio(5, 9), si::kelvin> {};
+
+// the origin of the Fahrenheit scale (32 °F is the ice point)
+struct fahrenheit_zero : point_origin<si::ice_point, degree_fahrenheit, ratio(-32)> {};
+
+}  // namespace units::physical::si::us
+
+namespace units {
+
+template<>
+struct default_point_origin<physical::si::us::degree_fahrenheit> {
+  using type = physical::si::us::fahrenheit_zero;
+};
+
+}  // namespace units
+
+namespace units::physical::si::us {
+
+template<QuantityValue Rep = double>
+using fahrenheit_point = quantity_point<si::dim_thermodynamic_temperature, degree_fahrenheit, Rep, fahrenheit_zero>;
+
+inline namespace literals {
+
+// deg_F
+constexpr auto operator"" _q_deg_F(unsigned long long l) { return si::thermodynamic_temperature<units::physical::si::us::degree_fahrenheit, std::int64_t>(l); }
+constexpr auto operator"" _q_deg_F(long double l) { return si::thermodynamic_temperature<units::physical::si::us::degree_fahrenheit, long double>(l); }
+
+}  // namespace literals
+
+namespace unit_constants {
+
+inline constexpr auto deg_F = si::thermodynamic_temperature<units::physical::si::us::degree_fahrenheit, one_rep>{};
+
+}  // namespace unit_constants
+
+}  // namespace units::physical::si::us
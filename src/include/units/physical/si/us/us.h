@@ -23,3 +23,4 @@
 #pragma once
 
 #include <units/physical/si/us/base/length.h>
+#include <units/physical/si/us/base/thermodynamic_temperature.h>
@@ -0,0 +1,125 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/bits/pow.h>
+#include <units/concepts.h>
+#include <units/ratio.h>
+#include <concepts>
+
+namespace units {
+
+/**
+ * @brief The implicit origin of quantity points
+ *
+ * The zero of the scale of a quantity (i.e. the absolute zero of the thermodynamic temperature).
+ */
+struct zero_origin {};
+
+/**
+ * @brief An origin of quantity points
+ *
+ * An origin displaced from the @c Reference origin by @c Offset expressed in the unit @c U.
+ * User-defined origins should derive from it. For example:
+ *
+ * struct ice_point : point_origin<zero_origin, kelvin, ratio(27'315, 100)> {};
+ *
+ * @tparam Reference an origin the offset is measured from
+ * @tparam U a unit of the offset
+ * @tparam Offset the value of the offset expressed in @c U
+ */
+template<typename Reference, Unit U, ratio Offset>
+struct point_origin {
+  static_assert(PointOrigin<Reference>);
+  using reference_origin = Reference;
+  using unit = U;
+  static constexpr ratio offset = Offset;
+};
+
+/**
+ * @brief The default origin of quantity points of a unit
+ *
+ * Quantity points are measured from the `zero_origin` unless the unit is defined on an offset
+ * scale. Such units (i.e. degree Celsius) should specialize this trait with the origin of their
+ * scale so that `quantity_point(20_q_deg_C)` is not silently measured from the absolute zero.
+ *
+ * @tparam U a unit of the quantity point
+ */
+template<Unit U>
+struct default_point_origin {
+  using type = zero_origin;
+};
+
+template<Unit U>
+using default_point_origin_t = TYPENAME default_point_origin<U>::type;
+
+namespace detail {
+
+// true if all the offsets of the origin O are expressed in units with the same reference as U
+template<PointOrigin O, Unit U>
+[[nodiscard]] consteval bool origin_compatible_with()
+{
+  if constexpr (std::same_as<O, zero_origin>)
+    return true;
+  else
+    return std::same_as<typename O::unit::reference, typename U::reference> &&
+           origin_compatible_with<typename O::reference_origin, U>();
+}
+
+template<typename T>
+[[nodiscard]] consteval T ratio_value(const ratio& r)
+{
+  return static_cast<T>(r.num) / static_cast<T>(r.den) * fpow10<T>(r.exp);
+}
+
+// exact sum of two ratios
+[[nodiscard]] consteval ratio ratio_add(const ratio& lhs, const ratio& rhs)
+{
+  if (lhs.num == 0) return rhs;
+  if (rhs.num == 0) return lhs;
+  const std::intmax_t exp = lhs.exp < rhs.exp ? lhs.exp : rhs.exp;
+  const std::intmax_t lhs_num = safe_multiply(lhs.num, ipow10(lhs.exp - exp));
+  const std::intmax_t rhs_num = safe_multiply(rhs.num, ipow10(rhs.exp - exp));
+  return ratio(safe_multiply(lhs_num, rhs.den) + safe_multiply(rhs_num, lhs.den), safe_multiply(lhs.den, rhs.den), exp);
+}
+
+// true if the (possibly negative) ratio has an integral value
+[[nodiscard]] consteval bool is_integral_value(const ratio& r)
+{
+  return r.num == 0 || is_integral(ratio(detail::abs(r.num), r.den, r.exp));
+}
+
+// offset of the origin O from the zero_origin expressed in the reference unit of its units
+template<PointOrigin O>
+[[nodiscard]] consteval ratio origin_offset()
+{
+  if constexpr (std::same_as<O, zero_origin>)
+    return ratio(0);
+  else
+    return ratio_add(origin_offset<typename O::reference_origin>(), O::offset * O::unit::ratio);
+}
+
+}  // namespace detail
+
+}  // namespace units
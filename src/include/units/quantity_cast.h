@@ -26,8 +26,16 @@
 #include <units/customization_points.h>
 #include <units/bits/dimension_op.h>
 #include <units/bits/external/type_traits.h>
+#include <units/bits/integral_scaling.h>
 #include <units/bits/pow.h>
+#include <units/point_origin.h>
 #include <cassert>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <gsl/gsl_assert>
 
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -39,7 +47,7 @@ namespace units {
 template<Dimension D, UnitOf<D> U, QuantityValue Rep>
 class quantity;
 
-template<Dimension D, UnitOf<D> U, QuantityValue Rep>
+template<Dimension D, UnitOf<D> U, QuantityValue Rep, PointOrigin Origin>
 class quantity_point;
 
 namespace detail {
@@ -88,8 +96,108 @@ struct cast_traits<From, To> {
   using rep_type = std::common_type_t<From, To>;
 };
 
+// Integral scaling factor with the decimal exponent of a ratio folded into its multiplier or divisor
+struct integral_factor {
+  std::intmax_t multiplier;
+  std::intmax_t divisor;
+};
+
+// true if the decimal exponent of a ratio can be folded into its multiplier or divisor without an overflow
+[[nodiscard]] constexpr bool has_integral_factor(const ratio& r)
+{
+  std::intmax_t num = r.num;
+  std::intmax_t den = r.den;
+  for (std::intmax_t exp = r.exp; exp > 0; --exp) {
+    if (num > INTMAX_MAX / 10) return false;
+    num *= 10;
+  }
+  for (std::intmax_t exp = r.exp; exp < 0; ++exp) {
+    if (den > INTMAX_MAX / 10) return false;
+    den *= 10;
+  }
+  return true;
+}
+
+// requires `has_integral_factor(r)`
+[[nodiscard]] constexpr integral_factor make_integral_factor(const ratio& r)
+{
+  const std::intmax_t multiplier = r.num * ipow10(r.exp > 0 ? r.exp : 0);
+  const std::intmax_t divisor = r.den * ipow10(r.exp < 0 ? -r.exp : 0);
+  const std::intmax_t gcd = std::gcd(multiplier, divisor);
+  return integral_factor{multiplier / gcd, divisor / gcd};
+}
+
+template<typename T>
+[[nodiscard]] CONSTEVAL auto make_conversion_factor(const ratio& r)
+{
+  if constexpr (treat_as_floating_point<T>) {
+    // fold the exponent into the numerator or the denominator for as long as they stay exactly
+    // representable in T so that the final division is the only rounding step
+    constexpr std::intmax_t max_exact = std::numeric_limits<T>::digits < std::numeric_limits<std::intmax_t>::digits ?
+                                        std::intmax_t(1) << std::numeric_limits<T>::digits : INTMAX_MAX;
+    std::intmax_t num = r.num;
+    std::intmax_t den = r.den;
+    std::intmax_t exp = r.exp;
+    for (; exp > 0 && num <= max_exact / 10; --exp) num *= 10;
+    for (; exp < 0 && den <= max_exact / 10; ++exp) den *= 10;
+    return static_cast<T>(num) / static_cast<T>(den) * fpow10<T>(exp);
+  }
+  else {
+    return make_integral_factor(r);
+  }
+}
+
+// scales a value by a compile-time integral factor
+template<integral_factor Factor, typename From, typename RatioType, typename T>
+[[nodiscard]] constexpr auto scale_by(const T& v)
+{
+  if constexpr (Factor.multiplier == 1 && Factor.divisor == 1) {
+    return v;
+  }
+  else if constexpr (std::signed_integral<RatioType> && std::same_as<T, RatioType> &&
+                     std::numeric_limits<RatioType>::digits <= 63) {
+    return scale_integral<Factor.multiplier, Factor.divisor, From>(v);
+  }
+  else if constexpr (Factor.divisor == 1) {
+    return v * static_cast<RatioType>(Factor.multiplier);
+  }
+  else if constexpr (Factor.multiplier == 1) {
+    return v / static_cast<RatioType>(Factor.divisor);
+  }
+  else {
+    return v * static_cast<RatioType>(Factor.multiplier) / static_cast<RatioType>(Factor.divisor);
+  }
+}
+
+// an integer scaled by a compile-time ratio (i.e. units::fixed_point)
+template<typename T>
+concept scaled_integer_ = // exposition only
+  requires(const T& v) {
+    requires std::integral<typename T::value_type>;
+    { T::scale } -> std::convertible_to<ratio>;
+    { v.raw() } -> std::same_as<typename T::value_type>;
+    { T::from_raw(v.raw()) } -> std::same_as<T>;
+  };
+
 }  // namespace detail
 
+/**
+ * @brief A conversion factor between the units of two quantities
+ *
+ * Computed only once at compile-time and used by @c quantity_cast to convert the value of @c From
+ * to the unit of @c To. For floating-point representation types it is a single number rounded only
+ * once. For integral ones it is a @c detail::integral_factor with the decimal exponent folded into
+ * its @c multiplier or @c divisor.
+ *
+ * @tparam From a source quantity type
+ * @tparam To a target quantity type
+ */
+template<Quantity From, Quantity To>
+  requires scalable_with_<typename From::rep, typename To::rep>
+inline constexpr auto conversion_factor_v =
+  detail::make_conversion_factor<typename detail::cast_traits<typename From::rep, typename To::rep>::ratio_type>(
+    detail::cast_ratio(From(), To()));
+
 /**
  * @brief Explicit cast of a quantity
  *
@@ -111,23 +219,22 @@ template<Quantity To, typename D, typename U, scalable_with_<typename To::rep> R
   using traits = detail::cast_traits<Rep, typename To::rep>;
   using ratio_type = TYPENAME traits::ratio_type;
   using rep_type = TYPENAME traits::rep_type;
-  constexpr auto c_ratio = detail::cast_ratio(quantity<D, U, Rep>(), To());
+  constexpr auto factor = conversion_factor_v<quantity<D, U, Rep>, To>;
 
-  if constexpr (treat_as_floating_point<rep_type>) {
-    return ret(static_cast<TYPENAME To::rep>(static_cast<rep_type>(q.count()) *
-                              (static_cast<ratio_type>(c_ratio.num) * detail::fpow10<ratio_type>(c_ratio.exp) / static_cast<ratio_type>(c_ratio.den))));
+  if constexpr (detail::scaled_integer_<Rep> && detail::scaled_integer_<typename To::rep>) {
+    // the ratio of units is folded into the change of scale so only the raw integer is scaled (if at all)
+    using to_rep = TYPENAME To::rep;
+    using raw_type = std::common_type_t<typename Rep::value_type, typename to_rep::value_type, std::intmax_t>;
+    constexpr auto raw_factor = detail::make_conversion_factor<raw_type>(
+      Rep::scale * detail::cast_ratio(quantity<D, U, Rep>(), To()) / to_rep::scale);
+    return ret(to_rep::from_raw(static_cast<TYPENAME to_rep::value_type>(
+      detail::scale_by<raw_factor, typename Rep::value_type, raw_type>(static_cast<raw_type>(q.count().raw())))));
+  }
+  else if constexpr (treat_as_floating_point<rep_type>) {
+    return ret(static_cast<TYPENAME To::rep>(static_cast<rep_type>(q.count()) * factor));
   }
   else {
-    if constexpr (c_ratio.exp > 0) {
-      return ret(static_cast<TYPENAME To::rep>(static_cast<rep_type>(q.count()) *
-                              (static_cast<ratio_type>(c_ratio.num) * static_cast<ratio_type>(detail::ipow10(c_ratio.exp))) /
-                              static_cast<ratio_type>(c_ratio.den)));
-    }
-    else {
-      return ret(static_cast<TYPENAME To::rep>(static_cast<rep_type>(q.count()) *
-                              static_cast<ratio_type>(c_ratio.num) /
-                              (static_cast<ratio_type>(c_ratio.den) * static_cast<ratio_type>(detail::ipow10(-c_ratio.exp)))));
-    }
+    return ret(static_cast<TYPENAME To::rep>(detail::scale_by<factor, Rep, ratio_type>(static_cast<rep_type>(q.count()))));
   }
 }
 
@@ -210,6 +317,115 @@ template<QuantityValue ToRep, typename D, typename U, scalable_with_<ToRep> Rep>
   return quantity_cast<quantity<D, U, ToRep>>(q);
 }
 
+/**
+ * @brief Explicit cast of a contiguous range of quantities
+ *
+ * Converts every element of @c from and stores the result in the corresponding element of @c to.
+ * The conversion factor is computed only once at compile-time (see @c conversion_factor_v) so the
+ * loop body is a plain scaling of the underlying values. For example:
+ *
+ * std::vector<length<millimetre, float>> frame = ...;
+ * std::vector<length<metre, float>> result(frame.size());
+ * units::quantity_cast<length<metre, float>>(std::span<const length<millimetre, float>>(frame), result);
+ *
+ * @tparam To a target quantity type to cast to
+ *
+ * @return @c to
+ */
+template<Quantity To, typename D, typename U, scalable_with_<typename To::rep> Rep, std::size_t Extent>
+  requires QuantityOf<To, D>
+constexpr std::span<To> quantity_cast(std::span<const quantity<D, U, Rep>, Extent> from, std::span<To> to)
+{
+  Expects(from.size() == to.size());
+
+  const std::size_t size = from.size();
+  for (std::size_t i = 0; i < size; ++i) {
+    to[i] = To(quantity_cast<To>(from[i]));
+  }
+  return to;
+}
+
+/**
+ * @brief Explicit in-place cast of a contiguous range of quantities
+ *
+ * Converts every element of @c data and replaces it with a quantity of type @c To stored in the
+ * same place in memory. Provided only when both quantity types are trivially copyable and have the
+ * same size and alignment. For example:
+ *
+ * std::vector<length<millimetre, float>> frame = ...;
+ * std::span<length<metre, float>> result = units::quantity_cast<length<metre, float>>(std::span(frame));
+ *
+ * @note After the cast the elements of @c data should be accessed only through the returned span.
+ *
+ * @note The conversion is done on the representation values in place only if both quantity types
+ *       have the same representation type. Otherwise, every element is converted and constructed
+ *       separately which is significantly slower as such a loop is usually not vectorized.
+ *
+ * @tparam To a target quantity type to cast to
+ *
+ * @return a span of converted quantities over the storage of @c data
+ */
+template<Quantity To, typename D, typename U, scalable_with_<typename To::rep> Rep, std::size_t Extent>
+  requires QuantityOf<To, D> && (sizeof(To) == sizeof(quantity<D, U, Rep>)) &&
+           (alignof(To) == alignof(quantity<D, U, Rep>)) &&
+           std::is_trivially_copyable_v<To> && std::is_trivially_copyable_v<quantity<D, U, Rep>>
+std::span<To, Extent> quantity_cast(std::span<quantity<D, U, Rep>, Extent> data)
+{
+  using from = quantity<D, U, Rep>;
+  auto* const out = reinterpret_cast<To*>(data.data());
+  const std::size_t size = data.size();
+  if constexpr (std::same_as<Rep, typename To::rep> && sizeof(Rep) == sizeof(To) &&
+                std::is_standard_layout_v<from> && std::is_standard_layout_v<To>) {
+    // convert the representation values in place (as viewed by `as_reps()`) so that the loop is vectorized
+    auto* const reps = reinterpret_cast<Rep*>(data.data());
+    for (std::size_t i = 0; i < size; ++i) {
+      reps[i] = quantity_cast<To>(from(reps[i])).count();
+    }
+  }
+  else {
+    for (std::size_t i = 0; i < size; ++i) {
+      const To q(quantity_cast<To>(data[i]));
+      std::construct_at(out + i, q);
+    }
+  }
+  return std::span<To, Extent>(out, size);
+}
+
+namespace detail {
+
+// the exact offset to add to a value of a quantity point with the origin From converted to the unit of To
+template<PointOrigin From, typename To>
+inline constexpr ratio origin_cast_offset =
+  ratio_add(origin_offset<From>(), ratio(-1) * origin_offset<typename To::origin>()) / To::unit::ratio;
+
+// converts a quantity point to the one of another origin with a single multiply-add of the
+// conversion factor and of the difference of the origins (both computed at compile time)
+template<QuantityPoint To, typename D, typename U, typename Rep, typename Origin>
+[[nodiscard]] constexpr To origin_cast(const quantity_point<D, U, Rep, Origin>& qp)
+{
+  static_assert(std::same_as<typename U::reference, typename To::unit::reference>,
+                "quantity points of different origins must be expressed in units of the same reference");
+  using to_quantity = TYPENAME To::quantity_type;
+  using traits = cast_traits<Rep, typename To::rep>;
+  using ratio_type = TYPENAME traits::ratio_type;
+  using rep_type = TYPENAME traits::rep_type;
+  constexpr ratio offset = origin_cast_offset<Origin, To>;
+
+  if constexpr (treat_as_floating_point<rep_type>) {
+    constexpr auto factor = conversion_factor_v<quantity<D, U, Rep>, to_quantity>;
+    constexpr auto b = static_cast<ratio_type>(ratio_value<long double>(offset));
+    return To(to_quantity(static_cast<TYPENAME To::rep>(static_cast<rep_type>(qp.relative().count()) * factor + b)));
+  }
+  else {
+    static_assert(is_integral_value(offset),
+                  "the difference of origins is not an integral value in the target unit (use a floating-point representation)");
+    constexpr std::intmax_t b = safe_multiply(offset.num, ipow10(offset.exp)) / offset.den;
+    return To(quantity_cast<to_quantity>(qp.relative()) + to_quantity(static_cast<TYPENAME To::rep>(b)));
+  }
+}
+
+}  // namespace detail
+
 /**
  * @brief Explicit cast of a quantity point
  *
@@ -224,17 +440,31 @@ template<QuantityValue ToRep, typename D, typename U, scalable_with_<ToRep> Rep>
  * auto q1 = units::quantity_point_cast<units::physical::si::second>(quantity_point{1_q_ms});
  * auto q1 = units::quantity_point_cast<int>(quantity_point{1_q_ms});
  *
+ * A cast to a quantity point type with a different origin also moves the point to that origin
+ * (i.e. a temperature in kelvins to degree Celsius). For example:
+ *
+ * auto t = units::quantity_point_cast<units::physical::si::celsius_point<>>(units::physical::si::kelvin_point<>(300_q_K));
+ *
  * @tparam CastSpec a target quantity point type to cast to or anything that works for quantity_cast
  */
-template<typename CastSpec, typename D, typename U, typename Rep>
+template<typename CastSpec, typename D, typename U, typename Rep, typename Origin>
   requires is_specialization_of<CastSpec, quantity_point> ||
            requires(quantity<D, U, Rep> q) { quantity_cast<CastSpec>(q); }
-[[nodiscard]] constexpr auto quantity_point_cast(const quantity_point<D, U, Rep>& qp)
+[[nodiscard]] constexpr auto quantity_point_cast(const quantity_point<D, U, Rep, Origin>& qp)
 {
-  if constexpr (is_specialization_of<CastSpec, quantity_point>)
-    return quantity_point(quantity_cast<typename CastSpec::quantity_type>(qp.relative()));
-  else
-    return quantity_point(quantity_cast<CastSpec>(qp.relative()));
+  const auto make_point = [](const auto& q) {
+    using q_type = std::remove_cvref_t<decltype(q)>;
+    return quantity_point<typename q_type::dimension, typename q_type::unit, typename q_type::rep, Origin>(q);
+  };
+  if constexpr (is_specialization_of<CastSpec, quantity_point>) {
+    if constexpr (std::same_as<typename CastSpec::origin, Origin>)
+      return make_point(quantity_cast<typename CastSpec::quantity_type>(qp.relative()));
+    else
+      return detail::origin_cast<CastSpec>(qp);
+  }
+  else {
+    return make_point(quantity_cast<CastSpec>(qp.relative()));
+  }
 }
 
 /**
@@ -253,13 +483,83 @@ template<typename CastSpec, typename D, typename U, typename Rep>
  * @tparam ToD a dimension type to use for a target quantity
  * @tparam ToU a unit type to use for a target quantity
  */
-template<Dimension ToD, Unit ToU, typename D, typename U, typename Rep>
+template<Dimension ToD, Unit ToU, typename D, typename U, typename Rep, typename Origin>
   requires equivalent<ToD, D> && UnitOf<ToU, ToD>
-[[nodiscard]] constexpr auto quantity_point_cast(const quantity_point<D, U, Rep>& q)
+[[nodiscard]] constexpr auto quantity_point_cast(const quantity_point<D, U, Rep, Origin>& q)
 {
-  return quantity_point_cast<quantity_point<ToD, ToU, Rep>>(q);
+  return quantity_point_cast<quantity_point<ToD, ToU, Rep, Origin>>(q);
 }
 
+/**
+ * @brief Explicit cast of a contiguous range of quantity points
+ *
+ * Converts every element of @c from and stores the result in the corresponding element of @c to.
+ * Both the conversion factor and the difference of the origins are computed only once at
+ * compile-time so the loop body is a single multiply-add of the underlying values. For example:
+ *
+ * std::vector<si::kelvin_point<float>> readings = ...;
+ * std::vector<si::celsius_point<float>> result(readings.size());
+ * units::quantity_point_cast<si::celsius_point<float>>(std::span<const si::kelvin_point<float>>(readings), result);
+ *
+ * @tparam To a target quantity point type to cast to
+ *
+ * @return @c to
+ */
+template<QuantityPoint To, typename D, typename U, typename Rep, typename Origin, std::size_t Extent>
+  requires requires(quantity_point<D, U, Rep, Origin> qp) { To(quantity_point_cast<To>(qp)); }
+constexpr std::span<To> quantity_point_cast(std::span<const quantity_point<D, U, Rep, Origin>, Extent> from,
+                                            std::span<To> to)
+{
+  Expects(from.size() == to.size());
+
+  const std::size_t size = from.size();
+  for (std::size_t i = 0; i < size; ++i) {
+    to[i] = To(quantity_point_cast<To>(from[i]));
+  }
+  return to;
+}
+
+/**
+ * @brief Explicit in-place cast of a contiguous range of quantity points
+ *
+ * Converts every element of @c data and replaces it with a quantity point of type @c To stored in
+ * the same place in memory. Provided only when both quantity point types are trivially copyable
+ * and have the same size and alignment.
+ *
+ * @note After the cast the elements of @c data should be accessed only through the returned span.
+ *
+ * @tparam To a target quantity point type to cast to
+ *
+ * @return a span of converted quantity points over the storage of @c data
+ */
+template<QuantityPoint To, typename D, typename U, typename Rep, typename Origin, std::size_t Extent>
+  requires requires(quantity_point<D, U, Rep, Origin> qp) { To(quantity_point_cast<To>(qp)); } &&
+           (sizeof(To) == sizeof(quantity_point<D, U, Rep, Origin>)) &&
+           (alignof(To) == alignof(quantity_point<D, U, Rep, Origin>)) &&
+           std::is_trivially_copyable_v<To> && std::is_trivially_copyable_v<quantity_point<D, U, Rep, Origin>>
+std::span<To, Extent> quantity_point_cast(std::span<quantity_point<D, U, Rep, Origin>, Extent> data)
+{
+  auto* const out = reinterpret_cast<To*>(data.data());
+  const std::size_t size = data.size();
+  for (std::size_t i = 0; i < size; ++i) {
+    const To qp(quantity_point_cast<To>(data[i]));
+    std::construct_at(out + i, qp);
+  }
+  return std::span<To, Extent>(out, size);
+}
+
+namespace detail {
+
+// converts a value expressed in the unit U of the dimension D to the quantity Q (used to build runtime
+// tables of conversions)
+template<Quantity Q, typename U, typename D = typename Q::dimension>
+Q convert_from(const typename Q::rep& value)
+{
+  return quantity_cast<Q>(quantity<D, U, typename Q::rep>(value));
+}
+
+}  // namespace detail
+
 }  // namespace units
 
 #ifdef _MSC_VER
@@ -25,37 +25,128 @@
 
 #include <units/bits/external/fixed_string_io.h>
 #include <units/quantity.h>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <locale>
 #include <sstream>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
 
 namespace units {
 
 namespace detail {
 
-template<typename CharT, class Traits, typename D, typename U, typename Rep>
-void to_stream(std::basic_ostream<CharT, Traits>& os, const quantity<D, U, Rep>& q)
+template<typename D, typename U>
+inline constexpr std::string_view unit_symbol_v(unit_text_v<D, U>.standard().c_str(), unit_text_v<D, U>.standard().size());
+
+template<typename CharT, class Traits, typename Rep>
+void to_stream(std::basic_ostream<CharT, Traits>& os, const Rep& value, std::string_view symbol)
 {
-  os << q.count();
-  constexpr auto symbol = detail::unit_text<D, U>();
-  if constexpr (symbol.standard().size()) {
-    os << " " << symbol.standard();
+  os << value;
+  if(!symbol.empty()) {
+    os << ' ';
+    if constexpr(std::same_as<CharT, char>)
+      os << symbol;
+    else
+      for(const char c : symbol) os << c;
   }
 }
 
-} //  namespace detail
+template<typename T>
+concept to_chars_formattable_ = // exposition only
+  std::floating_point<T> ||
+  (std::integral<T> && !std::same_as<T, bool> && !std::same_as<T, char> && !std::same_as<T, signed char> &&
+   !std::same_as<T, unsigned char> && !std::same_as<T, wchar_t> && !std::same_as<T, char8_t> &&
+   !std::same_as<T, char16_t> && !std::same_as<T, char32_t>);
 
-template<typename CharT, typename Traits, typename D, typename U, typename Rep>
-std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const quantity<D, U, Rep>& q)
-  requires requires { os << q.count(); }
+template<class Traits>
+bool write_fill(std::basic_streambuf<char, Traits>& buf, char fill, std::streamsize count)
 {
+  for(; count > 0; --count)
+    if(Traits::eq_int_type(buf.sputc(fill), Traits::eof())) return false;
+  return true;
+}
+
+/**
+ * @brief Writes a value and a unit symbol without the `std::num_put` facet and temporary strings
+ *
+ * The number is rendered with `std::to_chars()` into a stack buffer and padded directly in
+ * the stream buffer. Only applies to streams with the classic locale and formatting flags
+ * for which `std::to_chars()` gives the same result as `std::num_put`.
+ *
+ * @return `false` if nothing was written and `to_stream()` has to be used instead
+ */
+template<class Traits, to_chars_formattable_ Rep>
+bool to_stream_classic(std::basic_ostream<char, Traits>& os, const Rep& value, std::string_view symbol)
+{
+  const auto flags = os.flags();
+  const auto basefield = flags & std::ios_base::basefield;
+  if((flags & (std::ios_base::floatfield | std::ios_base::showpos | std::ios_base::showpoint | std::ios_base::uppercase)) ||
+     (basefield != std::ios_base::dec && basefield != std::ios_base::fmtflags{}) || os.precision() < 0 ||
+     os.getloc() != std::locale::classic())
+    return false;
+
+  std::array<char, 128> number;
+  std::to_chars_result res;
+  if constexpr(std::floating_point<Rep>)
+    res = std::to_chars(number.data(), number.data() + number.size(), value, std::chars_format::general,
+                        static_cast<int>(os.precision()));
+  else
+    res = std::to_chars(number.data(), number.data() + number.size(), value);
+  if(res.ec != std::errc()) return false;
+
+  const std::streamsize symbol_size = symbol.empty() ? 0 : static_cast<std::streamsize>(symbol.size()) + 1;
+  const std::streamsize number_size = res.ptr - number.data();
+
+  if(const typename std::basic_ostream<char, Traits>::sentry sentry(os); sentry) {
+    const std::streamsize padding = os.width() > number_size + symbol_size ? os.width() - number_size - symbol_size : 0;
+    const bool left = (flags & std::ios_base::adjustfield) == std::ios_base::left;
+    auto& buf = *os.rdbuf();
+    bool ok = left || write_fill(buf, os.fill(), padding);
+    ok = ok && buf.sputn(number.data(), number_size) == number_size;
+    if(symbol_size) {
+      ok = ok && buf.sputn(" ", 1) == 1;
+      ok = ok && buf.sputn(symbol.data(), symbol_size - 1) == symbol_size - 1;
+    }
+    ok = ok && (!left || write_fill(buf, os.fill(), padding));
+    if(!ok) os.setstate(std::ios_base::badbit);
+  }
+  os.width(0);
+  return true;
+}
+
+/**
+ * @brief Writes a value followed by a space and a unit symbol (if not empty)
+ *
+ * `std::setw()` and the other padding settings of the stream apply to the whole output.
+ */
+template<typename CharT, typename Traits, typename Rep>
+std::basic_ostream<CharT, Traits>& print_quantity(std::basic_ostream<CharT, Traits>& os, const Rep& value, std::string_view symbol)
+{
+  if constexpr(requires { detail::to_stream_classic(os, value, symbol); }) {
+    if(detail::to_stream_classic(os, value, symbol)) return os;
+  }
+
   if(os.width()) {
     // std::setw() applies to the whole quantity output so it has to be first put into std::string
     std::basic_ostringstream<CharT, Traits> s;
-    detail::to_stream(s, q);
+    detail::to_stream(s, value, symbol);
     return os << s.str();
   }
 
-  detail::to_stream(os, q);
+  detail::to_stream(os, value, symbol);
   return os;
 }
 
+} //  namespace detail
+
+template<typename CharT, typename Traits, typename D, typename U, typename Rep>
+std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const quantity<D, U, Rep>& q)
+  requires requires { os << q.count(); }
+{
+  return detail::print_quantity(os, q.count(), detail::unit_symbol_v<D, U>);
+}
+
 }  // namespace units
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <units/point_origin.h>
 #include <units/quantity.h>
 #include <compare>
 
@@ -31,19 +32,26 @@ namespace units {
 /**
  * @brief A quantity point
  *
- * An absolute quantity with respect to zero (which represents some origin).
+ * An absolute quantity with respect to an origin (the default origin of the unit which is the zero of
+ * the scale of the quantity for most of the units).
+ * Quantity points with different origins (i.e. temperatures in degree Celsius and in kelvins) are
+ * different types and can be converted only with `quantity_point_cast()`.
  *
  * @tparam D a dimension of the quantity point (can be either a BaseDimension or a DerivedDimension)
  * @tparam U a measurement unit of the quantity point
  * @tparam Rep a type to be used to represent values of a quantity point
+ * @tparam Origin an origin of the quantity point
  */
-template<Dimension D, UnitOf<D> U, QuantityValue Rep = double>
+template<Dimension D, UnitOf<D> U, QuantityValue Rep = double, PointOrigin Origin = default_point_origin_t<U>>
 class quantity_point {
+  static_assert(detail::origin_compatible_with<Origin, U>(), "the origin is not defined for the unit of the quantity point");
+
 public:
   using quantity_type = quantity<D, U, Rep>;
   using dimension = typename quantity_type::dimension;
   using unit = typename quantity_type::unit;
   using rep = typename quantity_type::rep;
+  using origin = Origin;
 
 private:
   quantity_type q_{};
@@ -58,7 +66,8 @@ public:
   constexpr explicit quantity_point(const Q& q) : q_{q} {}
 
   template<QuantityPoint QP2>
-    requires std::is_convertible_v<typename QP2::quantity_type, quantity_type>
+    requires std::same_as<typename QP2::origin, origin> &&
+             std::is_convertible_v<typename QP2::quantity_type, quantity_type>
   constexpr quantity_point(const QP2& qp) : q_{qp.relative()} {}
 
   quantity_point& operator=(const quantity_point&) = default;
@@ -127,7 +136,7 @@ public:
   {
     const auto q = lhs.relative() + rhs;
     using q_type = decltype(q);
-    return quantity_point<typename q_type::dimension, typename q_type::unit, typename q_type::rep>(q);
+    return quantity_point<typename q_type::dimension, typename q_type::unit, typename q_type::rep, origin>(q);
   }
 
   template<Quantity Q>
@@ -143,10 +152,11 @@ public:
   {
     const auto q = lhs.relative() - rhs;
     using q_type = decltype(q);
-    return quantity_point<typename q_type::dimension, typename q_type::unit, typename q_type::rep>(q);
+    return quantity_point<typename q_type::dimension, typename q_type::unit, typename q_type::rep, origin>(q);
   }
 
   template<QuantityPoint QP>
+    requires std::same_as<typename QP::origin, origin>
   [[nodiscard]] friend constexpr Quantity auto operator-(const quantity_point& lhs, const QP& rhs)
     requires requires { lhs.relative() - rhs.relative(); }
   {
@@ -154,14 +164,16 @@ public:
   }
 
   template<QuantityPoint QP>
-    requires std::three_way_comparable_with<quantity_type, typename QP::quantity_type>
+    requires std::same_as<typename QP::origin, origin> &&
+             std::three_way_comparable_with<quantity_type, typename QP::quantity_type>
   [[nodiscard]] friend constexpr auto operator<=>(const quantity_point& lhs, const QP& rhs)
   {
     return lhs.relative() <=> rhs.relative();
   }
 
   template<QuantityPoint QP>
-    requires std::equality_comparable_with<quantity_type, typename QP::quantity_type>
+    requires std::same_as<typename QP::origin, origin> &&
+             std::equality_comparable_with<quantity_type, typename QP::quantity_type>
   [[nodiscard]] friend constexpr bool operator==(const quantity_point& lhs, const QP& rhs)
   {
     return lhs.relative() == rhs.relative();
@@ -170,12 +182,12 @@ public:
 };
 
 template<typename D, typename U, typename Rep>
-quantity_point(quantity<D, U, Rep>) -> quantity_point<D, U, Rep>;
+quantity_point(quantity<D, U, Rep>) -> quantity_point<D, U, Rep, default_point_origin_t<U>>;
 
 namespace detail {
 
-template<typename D, typename U, typename Rep>
-inline constexpr bool is_quantity_point<quantity_point<D, U, Rep>> = true;
+template<typename D, typename U, typename Rep, typename Origin>
+inline constexpr bool is_quantity_point<quantity_point<D, U, Rep, Origin>> = true;
 
 }  // namespace detail
 
@@ -0,0 +1,95 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/quantity.h>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace units {
+
+namespace detail {
+
+template<typename From, typename To>
+using copy_const_t = std::conditional_t<std::is_const_v<From>, const To, To>;
+
+}  // namespace detail
+
+/**
+ * @brief A quantity that can be used as a view of its representation type
+ *
+ * Satisfied when a quantity is standard-layout, trivially copyable, and has the same size
+ * and alignment as its representation type so that an array of its representation values
+ * can be accessed as an array of quantities and vice versa.
+ */
+template<typename Q>
+concept RepLayoutQuantity =
+  Quantity<std::remove_const_t<Q>> &&
+  std::is_standard_layout_v<std::remove_const_t<Q>> &&
+  std::is_trivially_copyable_v<std::remove_const_t<Q>> &&
+  sizeof(Q) == sizeof(typename std::remove_const_t<Q>::rep) &&
+  alignof(Q) == alignof(typename std::remove_const_t<Q>::rep);
+
+/**
+ * @brief A non-owning view of a contiguous sequence of quantities
+ *
+ * @tparam Q a (possibly const-qualified) quantity type
+ * @tparam Extent the number of elements in the sequence or @c std::dynamic_extent
+ */
+template<typename Q, std::size_t Extent = std::dynamic_extent>
+  requires RepLayoutQuantity<Q>
+using quantity_span = std::span<Q, Extent>;
+
+/**
+ * @brief Views a contiguous sequence of numbers as quantities of type @c Q
+ *
+ * No values are copied. For example:
+ *
+ * double* buffer = ...;
+ * units::quantity_span<const length<metre>> distances = units::as_quantities<length<metre>>(std::span<const double>(buffer, size));
+ *
+ * @tparam Q a quantity type with the representation type of the values in @c reps
+ */
+template<RepLayoutQuantity Q, typename Rep, std::size_t Extent>
+  requires std::same_as<std::remove_const_t<Rep>, typename Q::rep>
+[[nodiscard]] inline quantity_span<detail::copy_const_t<Rep, Q>, Extent> as_quantities(std::span<Rep, Extent> reps) noexcept
+{
+  using ret = quantity_span<detail::copy_const_t<Rep, Q>, Extent>;
+  return ret(reinterpret_cast<TYPENAME ret::pointer>(reps.data()), reps.size());
+}
+
+/**
+ * @brief Views a contiguous sequence of quantities as their representation values
+ *
+ * No values are copied. This is the inverse of @c as_quantities().
+ */
+template<RepLayoutQuantity Q, std::size_t Extent>
+[[nodiscard]] inline auto as_reps(std::span<Q, Extent> quantities) noexcept
+{
+  using ret = std::span<detail::copy_const_t<Q, typename std::remove_const_t<Q>::rep>, Extent>;
+  return ret(reinterpret_cast<TYPENAME ret::pointer>(quantities.data()), quantities.size());
+}
+
+}  // namespace units
@@ -0,0 +1,242 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/bits/fnv1a.h>
+#include <units/bits/registered_units.h>
+#include <units/bits/unit_text.h>
+#include <units/dynamic_quantity.h>
+#include <units/hash.h>
+#include <units/ratio.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+namespace units {
+
+/**
+ * @brief Description of a unit provided by the `registry`
+ */
+struct unit_info {
+  std::string_view standard_symbol;
+  std::string_view ascii_symbol;
+  std::uint64_t dimension_id = 0;  ///< `dimension_id` of the dimension the unit is defined for
+  std::uint64_t unit_id = 0;       ///< `unit_id` of the unit
+  packed_dimension dimension;      ///< exponents of the dimension (the same for all systems of units)
+  ratio unit_ratio{1};             ///< exact ratio of the unit to its reference unit
+  double factor = 1;               ///< ratio of the unit to the product of the references of base units (i.e. metre, gram, second)
+
+  /**
+   * @brief A dynamic quantity with the value @c v expressed in this unit
+   */
+  [[nodiscard]] constexpr dynamic_quantity operator()(double v) const noexcept
+  {
+    return dynamic_quantity(v, factor, dimension);
+  }
+};
+
+namespace detail {
+
+template<Dimension D, UnitOf<D> U>
+[[nodiscard]] consteval unit_info make_unit_info()
+{
+  constexpr auto& txt = unit_text_v<D, U>;
+  return {std::string_view(txt.standard().c_str(), txt.standard().size()),
+          std::string_view(txt.ascii().c_str(), txt.ascii().size()), dimension_id<D>, unit_id<D, U>,
+          packed_dimension::of<D>(), U::ratio, packed_scale<D, U>};
+}
+
+template<Dimension D, typename... Us, std::size_t N>
+constexpr void append_unit_infos(registry_units<D, Us...>, std::array<unit_info, N>& entries, std::size_t& index)
+{
+  ((entries[index++] = make_unit_info<D, Us>()), ...);
+}
+
+template<typename... Groups>
+[[nodiscard]] consteval auto make_registry_entries(registry_groups<Groups...>)
+{
+  std::array<unit_info, (Groups::size + ...)> entries{};
+  std::size_t index = 0;
+  (append_unit_infos(Groups(), entries, index), ...);
+  return entries;
+}
+
+inline constexpr auto registry_entries = make_registry_entries(registered_units());
+
+/**
+ * @brief Compile-time perfect hash table of the symbols of units in @c Entries
+ *
+ * Uses the "hash and displace" scheme: symbols are distributed to buckets with one hash and
+ * every bucket gets a displacement (a seed of the second hash) placing all its symbols in
+ * free slots. Displacements are searched at compile time starting from the largest buckets
+ * so the lookup is two hashes and a single comparison of strings.
+ */
+template<const auto& Entries>
+class unit_info_table {
+  static constexpr std::size_t max_keys = 2 * Entries.size();
+  static constexpr std::size_t bucket_count = max_keys / 4 + 1;
+  static constexpr std::size_t slot_count = 2 * max_keys;
+  static constexpr std::size_t max_bucket_capacity = 32;
+
+  struct key {
+    std::string_view symbol;
+    std::size_t entry = 0;
+  };
+
+  struct table {
+    std::array<key, max_keys> keys{};
+    std::size_t size = 0;
+    std::array<std::uint32_t, bucket_count> displacements{};
+    std::array<std::uint32_t, slot_count> slots{};  // 1-based index into `keys`, 0 for an empty slot
+  };
+
+  [[nodiscard]] static constexpr std::uint64_t mix(std::uint64_t hash) { return (hash * 0x9E3779B97F4A7C15ULL) >> 32; }
+
+  [[nodiscard]] static constexpr std::size_t bucket_of(std::string_view symbol)
+  {
+    return static_cast<std::size_t>(mix(fnv1a(symbol)) % bucket_count);
+  }
+
+  [[nodiscard]] static constexpr std::size_t slot_of(std::string_view symbol, std::uint32_t displacement)
+  {
+    return static_cast<std::size_t>(mix(fnv1a(symbol, fnv1a_offset_basis ^ (displacement + 1))) % slot_count);
+  }
+
+  static CONSTEVAL table make_table()
+  {
+    // all the symbols grouped by buckets (counting sort)
+    std::array<key, max_keys> symbols{};
+    std::size_t symbol_count = 0;
+    for (std::size_t i = 0; i < Entries.size(); ++i) {
+      symbols[symbol_count++] = {Entries[i].standard_symbol, i};
+      if (Entries[i].ascii_symbol != Entries[i].standard_symbol) symbols[symbol_count++] = {Entries[i].ascii_symbol, i};
+    }
+    std::array<std::size_t, max_keys> symbol_buckets{};
+    std::array<std::size_t, bucket_count + 1> bucket_begin{};
+    for (std::size_t i = 0; i < symbol_count; ++i) {
+      symbol_buckets[i] = bucket_of(symbols[i].symbol);
+      ++bucket_begin[symbol_buckets[i] + 1];
+    }
+    for (std::size_t b = 0; b < bucket_count; ++b) bucket_begin[b + 1] += bucket_begin[b];
+    std::array<key, max_keys> sorted{};
+    std::array<std::size_t, bucket_count> filled{};
+    for (std::size_t i = 0; i < symbol_count; ++i)
+      sorted[bucket_begin[symbol_buckets[i]] + filled[symbol_buckets[i]]++] = symbols[i];
+
+    // keys without duplicates (the same unit defined in more than one system is registered once)
+    table t;
+    std::array<std::size_t, bucket_count + 1> key_begin{};
+    std::size_t max_bucket_size = 0;
+    for (std::size_t b = 0; b < bucket_count; ++b) {
+      key_begin[b] = t.size;
+      for (std::size_t i = bucket_begin[b]; i < bucket_begin[b + 1]; ++i) {
+        bool duplicate = false;
+        for (std::size_t j = key_begin[b]; j < t.size && !duplicate; ++j) {
+          if (t.keys[j].symbol == sorted[i].symbol) {
+            const unit_info& e1 = Entries[t.keys[j].entry];
+            const unit_info& e2 = Entries[sorted[i].entry];
+            if (e1.dimension != e2.dimension || e1.factor != e2.factor)
+              throw std::invalid_argument("ambiguous unit symbol");
+            duplicate = true;
+          }
+        }
+        if (!duplicate) t.keys[t.size++] = sorted[i];
+      }
+      if (t.size - key_begin[b] > max_bucket_size) max_bucket_size = t.size - key_begin[b];
+    }
+    key_begin[bucket_count] = t.size;
+    if (max_bucket_size > max_bucket_capacity) throw std::invalid_argument("too many unit symbols in a bucket");
+
+    // place the largest buckets first while there are still many free slots
+    for (std::size_t size = max_bucket_size; size > 0; --size) {
+      for (std::size_t b = 0; b < bucket_count; ++b) {
+        if (key_begin[b + 1] - key_begin[b] != size) continue;
+
+        for (std::uint32_t d = 0;; ++d) {
+          std::array<std::size_t, max_bucket_capacity> taken{};
+          bool ok = true;
+          for (std::size_t m = 0; m < size && ok; ++m) {
+            const auto slot = slot_of(t.keys[key_begin[b] + m].symbol, d);
+            ok = t.slots[slot] == 0;
+            for (std::size_t j = 0; j < m && ok; ++j) ok = taken[j] != slot;
+            taken[m] = slot;
+          }
+          if (ok) {
+            t.displacements[b] = d;
+            for (std::size_t m = 0; m < size; ++m) t.slots[taken[m]] = static_cast<std::uint32_t>(key_begin[b] + m + 1);
+            break;
+          }
+        }
+      }
+    }
+    return t;
+  }
+
+  static constexpr table table_ = make_table();
+
+public:
+  /**
+   * @brief Returns the entry of the unit having the provided symbol or @c nullptr if not found
+   */
+  [[nodiscard]] static constexpr const unit_info* find(std::string_view symbol)
+  {
+    const auto slot = table_.slots[slot_of(symbol, table_.displacements[bucket_of(symbol)])];
+    if (slot == 0 || table_.keys[slot - 1].symbol != symbol) return nullptr;
+    return &Entries[table_.keys[slot - 1].entry];
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Compile-time registry of the units of the library
+ *
+ * Provides the lookup of units by their standard or ASCII symbols (i.e. "km/h", "µs" or "us")
+ * at runtime. The table of units and its perfect hash are generated at compile time so there
+ * is no initialization at program startup and no dynamic memory allocation. Units defined in
+ * more than one system (i.e. "ft") are registered once.
+ *
+ * @note The registry contains all the units of `units::physical::si`, its sub-namespaces for
+ *       other systems of units, and `units::data` except for the temperature units with non-zero
+ *       origins (degree Celsius and degree Fahrenheit).
+ */
+class registry {
+  using table = detail::unit_info_table<detail::registry_entries>;
+
+public:
+  /**
+   * @brief All the registered units
+   */
+  [[nodiscard]] static constexpr std::span<const unit_info> entries() noexcept { return detail::registry_entries; }
+
+  /**
+   * @brief Returns the unit having the provided symbol or @c nullptr if not found
+   */
+  [[nodiscard]] static constexpr const unit_info* find(std::string_view symbol) { return table::find(symbol); }
+};
+
+}  // namespace units
@@ -0,0 +1,293 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <units/hash.h>
+#include <units/quantity_cast.h>
+#include <units/quantity_span.h>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <system_error>
+#include <type_traits>
+
+namespace units {
+
+/**
+ * @brief Layout of quantities in the binary wire format
+ */
+enum class wire_format : std::uint8_t {
+  tagged,   ///< values are preceded with a tag of their unit (`unit_id`) and of their representation type
+  untagged  ///< values only (the receiver has to know the unit)
+};
+
+/**
+ * @brief A result of `deserialize()`
+ */
+struct deserialize_result {
+  const std::byte* ptr;  ///< pointer to the first byte not consumed
+  std::errc ec;          ///< error code or a value initialized `std::errc` on success
+  std::size_t size = 0;  ///< number of quantities read
+};
+
+namespace detail {
+
+template<typename T>
+concept wire_rep = std::is_arithmetic_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template<std::size_t N>
+using wire_uint = std::conditional_t<N == 1, std::uint8_t,
+                  std::conditional_t<N == 2, std::uint16_t,
+                  std::conditional_t<N == 4, std::uint32_t, std::uint64_t>>>;
+
+// kind of a representation type ('i' - signed, 'u' - unsigned, 'f' - floating-point)
+template<wire_rep T>
+inline constexpr char wire_rep_kind = std::is_floating_point_v<T> ? 'f' : std::is_signed_v<T> ? 'i' : 'u';
+
+// tag layout: a little-endian 64-bit `unit_id` followed by the kind and the size of the representation type
+inline constexpr std::size_t wire_tag_size = sizeof(std::uint64_t) + 2;
+inline constexpr std::size_t wire_count_size = sizeof(std::uint64_t);
+
+template<wire_rep T>
+std::byte* store_le(const T& value, std::byte* out) noexcept
+{
+  if constexpr (std::endian::native == std::endian::little) {
+    std::memcpy(out, &value, sizeof(T));
+  } else {
+    auto bits = std::bit_cast<wire_uint<sizeof(T)>>(value);
+    for (std::size_t i = 0; i < sizeof(T); ++i, bits >>= 8) out[i] = static_cast<std::byte>(bits & 0xFF);
+  }
+  return out + sizeof(T);
+}
+
+template<wire_rep T>
+T load_le(const std::byte* in) noexcept
+{
+  if constexpr (std::endian::native == std::endian::little) {
+    T value;
+    std::memcpy(&value, in, sizeof(T));
+    return value;
+  } else {
+    wire_uint<sizeof(T)> bits = 0;
+    for (std::size_t i = sizeof(T); i > 0; --i) bits = (bits << 8) | static_cast<wire_uint<sizeof(T)>>(in[i - 1]);
+    return std::bit_cast<T>(bits);
+  }
+}
+
+template<Quantity Q>
+std::byte* store_tag(std::byte* out) noexcept
+{
+  using rep = TYPENAME Q::rep;
+  out = store_le(unit_id<typename Q::dimension, typename Q::unit>, out);
+  *out++ = static_cast<std::byte>(wire_rep_kind<rep>);
+  *out++ = static_cast<std::byte>(sizeof(rep));
+  return out;
+}
+
+// tags of the units accepted by `deserialize()` and the conversions from them to the unit of Q
+template<Quantity Q, typename... Units>
+struct wire_unit_table {
+  using rep = TYPENAME Q::rep;
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+  static constexpr std::array<std::uint64_t, 1 + sizeof...(Units)> tags = {
+    unit_id<typename Q::dimension, typename Q::unit>, unit_id<typename Q::dimension, Units>...};
+  static constexpr std::array<Q (*)(const rep&), 1 + sizeof...(Units)> converters = {
+    &convert_from<Q, typename Q::unit>, &convert_from<Q, Units>...};
+
+  // the index of the unit of a tag or `npos` if the unit is not accepted or the representation type differs
+  [[nodiscard]] static std::size_t find(const std::byte* tag) noexcept
+  {
+    if (tag[sizeof(std::uint64_t)] != static_cast<std::byte>(wire_rep_kind<rep>) ||
+        tag[sizeof(std::uint64_t) + 1] != static_cast<std::byte>(sizeof(rep)))
+      return npos;
+    const auto id = load_le<std::uint64_t>(tag);
+    for (std::size_t i = 0; i < tags.size(); ++i)
+      if (tags[i] == id) return i;
+    return npos;
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A number of bytes needed to serialize a quantity of type @c Q
+ */
+template<Quantity Q>
+  requires detail::wire_rep<typename Q::rep>
+[[nodiscard]] constexpr std::size_t serialized_size(wire_format fmt = wire_format::tagged) noexcept
+{
+  return (fmt == wire_format::tagged ? detail::wire_tag_size : 0) + sizeof(typename Q::rep);
+}
+
+/**
+ * @brief A number of bytes needed to serialize @c count quantities of type @c Q as a sequence
+ */
+template<Quantity Q>
+  requires detail::wire_rep<typename Q::rep>
+[[nodiscard]] constexpr std::size_t serialized_size(std::size_t count, wire_format fmt = wire_format::tagged) noexcept
+{
+  return (fmt == wire_format::tagged ? detail::wire_tag_size : 0) + detail::wire_count_size +
+         count * sizeof(typename Q::rep);
+}
+
+/**
+ * @brief Writes a quantity in a binary wire format
+ *
+ * Writes the value of the quantity as a little-endian number preceded (for `wire_format::tagged`)
+ * with a tag: a little-endian 64-bit `unit_id` of its unit identifying both the dimension and the
+ * unit, and one byte of the kind (signed, unsigned or floating-point) and one byte of the size
+ * of the representation type.
+ *
+ * @param out buffer of at least `serialized_size<Q>(fmt)` bytes
+ *
+ * @return pointer past the last byte written
+ */
+template<Quantity Q>
+  requires detail::wire_rep<typename Q::rep>
+std::byte* serialize(const Q& q, std::byte* out, wire_format fmt = wire_format::tagged) noexcept
+{
+  if (fmt == wire_format::tagged)
+    out = detail::store_tag<Q>(out);
+  return detail::store_le(q.count(), out);
+}
+
+/**
+ * @brief Writes a sequence of quantities in a binary wire format
+ *
+ * Writes the optional tag once followed by a little-endian 64-bit number of quantities
+ * and their little-endian values. On little-endian platforms the values are copied with a single
+ * `std::memcpy()`.
+ *
+ * @param out buffer of at least `serialized_size<Q>(qs.size(), fmt)` bytes
+ *
+ * @return pointer past the last byte written
+ */
+template<typename Q, std::size_t Extent>
+  requires Quantity<std::remove_const_t<Q>> && detail::wire_rep<typename Q::rep>
+std::byte* serialize(std::span<Q, Extent> qs, std::byte* out, wire_format fmt = wire_format::tagged) noexcept
+{
+  using quantity_type = std::remove_const_t<Q>;
+  if (fmt == wire_format::tagged)
+    out = detail::store_tag<quantity_type>(out);
+  out = detail::store_le(static_cast<std::uint64_t>(qs.size()), out);
+  if constexpr (std::endian::native == std::endian::little && RepLayoutQuantity<Q>) {
+    if (!qs.empty()) std::memcpy(out, qs.data(), qs.size_bytes());
+    return out + qs.size_bytes();
+  } else {
+    for (const auto& q : qs) out = detail::store_le(q.count(), out);
+    return out;
+  }
+}
+
+/**
+ * @brief Reads a quantity written with `serialize()`
+ *
+ * For `wire_format::tagged` the value is converted to the unit of @c Q if the tag denotes one
+ * of the additionally provided @c Units. The conversion functions are selected with a lookup
+ * in a compile-time table of their tags so no conversion is done when the units match.
+ * The representation type of the sender has to be the same as `Q::rep` (its kind and size are
+ * verified only for `wire_format::tagged`).
+ *
+ * @tparam Q quantity type to read
+ * @tparam Units additional units of the same dimension accepted in the input
+ *
+ * @return `deserialize_result` with `ptr` pointing past the consumed bytes or with `ec` set to
+ *         `std::errc::message_size` if the input is too short and `std::errc::invalid_argument`
+ *         if the tag does not denote an accepted unit or the representation type of the sender
+ *         differs (`ptr` is @c first then)
+ */
+template<Quantity Q, UnitOf<typename Q::dimension>... Units>
+  requires detail::wire_rep<typename Q::rep>
+deserialize_result deserialize(const std::byte* first, const std::byte* last, Q& q,
+                               wire_format fmt = wire_format::tagged) noexcept
+{
+  using rep = TYPENAME Q::rep;
+  using table = detail::wire_unit_table<Q, Units...>;
+
+  auto ptr = first;
+  std::size_t index = 0;
+  if (fmt == wire_format::tagged) {
+    if (static_cast<std::size_t>(last - ptr) < detail::wire_tag_size) return {first, std::errc::message_size};
+    index = table::find(ptr);
+    if (index == table::npos) return {first, std::errc::invalid_argument};
+    ptr += detail::wire_tag_size;
+  }
+  if (static_cast<std::size_t>(last - ptr) < sizeof(rep)) return {first, std::errc::message_size};
+
+  const auto value = detail::load_le<rep>(ptr);
+  q = index == 0 ? Q(value) : table::converters[index](value);
+  return {ptr + sizeof(rep), std::errc(), 1};
+}
+
+/**
+ * @brief Reads a sequence of quantities written with `serialize()`
+ *
+ * Values written in the unit of @c Q are copied with a single `std::memcpy()` on little-endian
+ * platforms; values in one of the additionally provided @c Units are converted one by one.
+ *
+ * @param out storage for the quantities read
+ *
+ * @return `deserialize_result` with `ptr` pointing past the consumed bytes and `size` being the
+ *         number of quantities read, or with `ec` set as for a single quantity and additionally
+ *         to `std::errc::result_out_of_range` if @c out is too small (`ptr` is @c first then)
+ */
+template<Quantity Q, UnitOf<typename Q::dimension>... Units, std::size_t Extent>
+  requires detail::wire_rep<typename Q::rep>
+deserialize_result deserialize(const std::byte* first, const std::byte* last, std::span<Q, Extent> out,
+                               wire_format fmt = wire_format::tagged) noexcept
+{
+  using rep = TYPENAME Q::rep;
+  using table = detail::wire_unit_table<Q, Units...>;
+
+  if (static_cast<std::size_t>(last - first) < serialized_size<Q>(0, fmt)) return {first, std::errc::message_size};
+
+  auto ptr = first;
+  std::size_t index = 0;
+  if (fmt == wire_format::tagged) {
+    index = table::find(ptr);
+    if (index == table::npos) return {first, std::errc::invalid_argument};
+    ptr += detail::wire_tag_size;
+  }
+
+  const auto count = detail::load_le<std::uint64_t>(ptr);
+  ptr += detail::wire_count_size;
+  if (count > out.size()) return {first, std::errc::result_out_of_range};
+  const auto size = static_cast<std::size_t>(count);
+  if (static_cast<std::size_t>(last - ptr) / sizeof(rep) < size) return {first, std::errc::message_size};
+
+  if constexpr (std::endian::native == std::endian::little && RepLayoutQuantity<Q>) {
+    if (index == 0) {
+      if (size != 0) std::memcpy(out.data(), ptr, size * sizeof(rep));
+      return {ptr + size * sizeof(rep), std::errc(), size};
+    }
+  }
+  const auto convert = table::converters[index];
+  for (std::size_t i = 0; i < size; ++i, ptr += sizeof(rep)) out[i] = convert(detail::load_le<rep>(ptr));
+  return {ptr, std::errc(), size};
+}
+
+}  // namespace units
@@ -0,0 +1,339 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/quantity_span.h>
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace units {
+
+namespace detail {
+
+template<typename T>
+concept soa_field = (Quantity<T> || QuantityPoint<T>) && std::is_trivially_copyable_v<T>;
+
+/**
+ * @brief A proxy reference to a single record of a @c soa_vector
+ *
+ * Behaves like a reference to a structure of @c Fields. Its fields are accessed with @c get<I>()
+ * or with a structured binding declaration.
+ */
+template<bool Const, typename... Fields>
+class soa_reference {
+  template<typename T>
+  using field_ref = std::conditional_t<Const, const T&, T&>;
+
+  std::tuple<std::conditional_t<Const, const Fields*, Fields*>...> fields_;
+
+public:
+  using value_type = std::tuple<Fields...>;
+
+  constexpr explicit soa_reference(std::conditional_t<Const, const Fields*, Fields*>... fields) noexcept :
+      fields_(fields...)
+  {
+  }
+
+  constexpr soa_reference(const soa_reference&) = default;
+
+  constexpr soa_reference(const soa_reference<!Const, Fields...>& other) noexcept
+    requires Const
+      : fields_(other.fields_)
+  {
+  }
+
+  // assignment writes through to the referenced record
+  constexpr const soa_reference& operator=(const soa_reference& other) const
+    requires(!Const)
+  {
+    return *this = value_type(other);
+  }
+
+  constexpr const soa_reference& operator=(const value_type& v) const
+    requires(!Const)
+  {
+    assign(v, std::index_sequence_for<Fields...>());
+    return *this;
+  }
+
+  template<std::size_t I>
+  [[nodiscard]] constexpr field_ref<std::tuple_element_t<I, value_type>> get() const noexcept
+  {
+    return *std::get<I>(fields_);
+  }
+
+  [[nodiscard]] constexpr operator value_type() const
+  {
+    return std::apply([](const auto*... fields) { return value_type(*fields...); }, fields_);
+  }
+
+  template<bool OtherConst>
+  [[nodiscard]] friend constexpr bool operator==(const soa_reference& lhs, const soa_reference<OtherConst, Fields...>& rhs)
+  {
+    return value_type(lhs) == value_type(rhs);
+  }
+
+private:
+  template<bool, typename...>
+  friend class soa_reference;
+
+  template<std::size_t... Is>
+  constexpr void assign(const value_type& v, std::index_sequence<Is...>) const
+  {
+    ((*std::get<Is>(fields_) = std::get<Is>(v)), ...);
+  }
+};
+
+template<std::size_t I, bool Const, typename... Fields>
+[[nodiscard]] constexpr decltype(auto) get(const soa_reference<Const, Fields...>& ref) noexcept
+{
+  return ref.template get<I>();
+}
+
+}  // namespace detail
+
+/**
+ * @brief A sequence container storing records of quantities as a structure of arrays
+ *
+ * Every field of a record is stored in its own contiguous column so that algorithms touching
+ * only some of the fields do not waste cache bandwidth on the others. Columns are accessible
+ * with @c column<I>() as spans (@c quantity_span for quantities). Elements are accessed through
+ * proxy references behaving like a structure of @c Fields. For example:
+ *
+ * units::soa_vector<si::time<si::second>, si::length<si::kilometre>> track;
+ * track.push_back(10_q_s, 1_q_km);
+ * auto [duration, distance] = track[0];
+ * auto total = std::accumulate(track.column<1>().begin(), track.column<1>().end(), 0_q_km);
+ *
+ * Operations growing the container (@c push_back() and @c resize()) provide the strong exception
+ * guarantee: if growing one of the columns throws, the columns already grown are truncated back to
+ * the previous size so all of them always have the same size.
+ *
+ * @tparam Fields quantities or quantity points stored in a record
+ */
+template<typename... Fields>
+  requires(sizeof...(Fields) > 0) && (detail::soa_field<Fields> && ...)
+class soa_vector {
+  std::tuple<std::vector<Fields>...> columns_;
+
+  template<bool Const>
+  class basic_iterator;
+
+public:
+  using value_type = std::tuple<Fields...>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = detail::soa_reference<false, Fields...>;
+  using const_reference = detail::soa_reference<true, Fields...>;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  template<std::size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  soa_vector() = default;
+
+  explicit soa_vector(size_type count) : columns_(std::vector<Fields>(count)...) {}
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return std::get<0>(columns_).size(); }
+  [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+  // the number of records that can be appended without a reallocation of any column
+  [[nodiscard]] constexpr size_type capacity() const noexcept
+  {
+    return std::apply([](const auto&... column) { return std::min({column.capacity()...}); }, columns_);
+  }
+
+  constexpr void reserve(size_type new_cap)
+  {
+    std::apply([&](auto&... column) { (column.reserve(new_cap), ...); }, columns_);
+  }
+
+  constexpr void resize(size_type count)
+  {
+    const size_type old_size = size();
+    try {
+      std::apply([&](auto&... column) { (column.resize(count), ...); }, columns_);
+    }
+    catch (...) {
+      truncate(old_size);
+      throw;
+    }
+  }
+
+  constexpr void clear() noexcept
+  {
+    std::apply([](auto&... column) { (column.clear(), ...); }, columns_);
+  }
+
+  constexpr void push_back(const Fields&... fields)
+  {
+    push_back(value_type(fields...));
+  }
+
+  constexpr void push_back(const value_type& v)
+  {
+    const size_type old_size = size();
+    try {
+      push_back_impl(v, std::index_sequence_for<Fields...>());
+    }
+    catch (...) {
+      truncate(old_size);
+      throw;
+    }
+  }
+
+  constexpr void pop_back()
+  {
+    std::apply([](auto&... column) { (column.pop_back(), ...); }, columns_);
+  }
+
+  [[nodiscard]] constexpr reference operator[](size_type pos) { return make_reference<reference>(*this, pos); }
+  [[nodiscard]] constexpr const_reference operator[](size_type pos) const { return make_reference<const_reference>(*this, pos); }
+
+  [[nodiscard]] constexpr reference front() { return (*this)[0]; }
+  [[nodiscard]] constexpr const_reference front() const { return (*this)[0]; }
+  [[nodiscard]] constexpr reference back() { return (*this)[size() - 1]; }
+  [[nodiscard]] constexpr const_reference back() const { return (*this)[size() - 1]; }
+
+  /**
+   * @brief All the values of the I-th field as a contiguous range
+   */
+  template<std::size_t I>
+  [[nodiscard]] constexpr std::span<field_type<I>> column() noexcept
+  {
+    return std::get<I>(columns_);
+  }
+
+  template<std::size_t I>
+  [[nodiscard]] constexpr std::span<const field_type<I>> column() const noexcept
+  {
+    return std::get<I>(columns_);
+  }
+
+  [[nodiscard]] constexpr iterator begin() noexcept { return iterator(this, 0); }
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  [[nodiscard]] constexpr iterator end() noexcept { return iterator(this, size()); }
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return const_iterator(this, size()); }
+  [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return begin(); }
+  [[nodiscard]] constexpr const_iterator cend() const noexcept { return end(); }
+
+private:
+  template<typename Ref, typename Self>
+  [[nodiscard]] static constexpr Ref make_reference(Self& self, size_type pos)
+  {
+    return std::apply([&](auto&... column) { return Ref(column.data() + pos...); }, self.columns_);
+  }
+
+  template<std::size_t... Is>
+  constexpr void push_back_impl(const value_type& v, std::index_sequence<Is...>)
+  {
+    (std::get<Is>(columns_).push_back(std::get<Is>(v)), ...);
+  }
+
+  // rolls back the columns grown before an exception (shrinking does not reallocate nor throw)
+  constexpr void truncate(size_type count) noexcept
+  {
+    std::apply([&](auto&... column) { ((column.size() > count ? column.resize(count) : void()), ...); }, columns_);
+  }
+};
+
+template<typename... Fields>
+  requires(sizeof...(Fields) > 0) && (detail::soa_field<Fields> && ...)
+template<bool Const>
+class soa_vector<Fields...>::basic_iterator {
+  using container = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+  container* c_ = nullptr;
+  size_type pos_ = 0;
+
+public:
+  // the reference is a proxy so only the C++20 iterator concept may be random access
+  using iterator_category = std::input_iterator_tag;
+  using iterator_concept = std::random_access_iterator_tag;
+  using value_type = soa_vector::value_type;
+  using difference_type = soa_vector::difference_type;
+  using reference = std::conditional_t<Const, soa_vector::const_reference, soa_vector::reference>;
+
+  basic_iterator() = default;
+  constexpr basic_iterator(container* c, size_type pos) noexcept : c_(c), pos_(pos) {}
+  constexpr basic_iterator(const basic_iterator<!Const>& other) noexcept
+    requires Const
+      : c_(other.c_), pos_(other.pos_)
+  {
+  }
+
+  [[nodiscard]] constexpr reference operator*() const { return (*c_)[pos_]; }
+  [[nodiscard]] constexpr reference operator[](difference_type n) const { return (*c_)[pos_ + static_cast<size_type>(n)]; }
+
+  constexpr basic_iterator& operator++() noexcept { ++pos_; return *this; }
+  constexpr basic_iterator operator++(int) noexcept { auto it = *this; ++pos_; return it; }
+  constexpr basic_iterator& operator--() noexcept { --pos_; return *this; }
+  constexpr basic_iterator operator--(int) noexcept { auto it = *this; --pos_; return it; }
+  constexpr basic_iterator& operator+=(difference_type n) noexcept { pos_ += static_cast<size_type>(n); return *this; }
+  constexpr basic_iterator& operator-=(difference_type n) noexcept { pos_ -= static_cast<size_type>(n); return *this; }
+
+  [[nodiscard]] friend constexpr basic_iterator operator+(basic_iterator it, difference_type n) noexcept { return it += n; }
+  [[nodiscard]] friend constexpr basic_iterator operator+(difference_type n, basic_iterator it) noexcept { return it += n; }
+  [[nodiscard]] friend constexpr basic_iterator operator-(basic_iterator it, difference_type n) noexcept { return it -= n; }
+  [[nodiscard]] friend constexpr difference_type operator-(const basic_iterator& lhs, const basic_iterator& rhs) noexcept
+  {
+    return static_cast<difference_type>(lhs.pos_) - static_cast<difference_type>(rhs.pos_);
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept { return lhs.pos_ == rhs.pos_; }
+  [[nodiscard]] friend constexpr auto operator<=>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept { return lhs.pos_ <=> rhs.pos_; }
+
+private:
+  friend class basic_iterator<!Const>;
+};
+
+}  // namespace units
+
+template<bool Const, typename... Fields>
+struct std::tuple_size<units::detail::soa_reference<Const, Fields...>> : std::integral_constant<std::size_t, sizeof...(Fields)> {};
+
+template<std::size_t I, bool Const, typename... Fields>
+struct std::tuple_element<I, units::detail::soa_reference<Const, Fields...>> {
+  using type = std::conditional_t<Const, const std::tuple_element_t<I, std::tuple<Fields...>>&,
+                                  std::tuple_element_t<I, std::tuple<Fields...>>&>;
+};
+
+// a proxy reference and a record have a common reference (a record) as required by `std::indirectly_readable`
+template<bool Const, typename... Fields, template<typename> typename TQual, template<typename> typename UQual>
+struct std::basic_common_reference<units::detail::soa_reference<Const, Fields...>, std::tuple<Fields...>, TQual, UQual> {
+  using type = std::tuple<Fields...>;
+};
+
+template<bool Const, typename... Fields, template<typename> typename TQual, template<typename> typename UQual>
+struct std::basic_common_reference<std::tuple<Fields...>, units::detail::soa_reference<Const, Fields...>, TQual, UQual> {
+  using type = std::tuple<Fields...>;
+};
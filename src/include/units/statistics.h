@@ -0,0 +1,323 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/quantity.h>
+#include <units/ratio.h>
+#include <gsl/gsl_assert>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace units {
+
+namespace detail {
+
+/**
+ * @brief A mergeable sketch of a distribution of values providing quantiles with a relative accuracy
+ *
+ * Values are counted in logarithmically sized buckets (DDSketch, C. Masson, J. E. Rim, H. K. Lee,
+ * "DDSketch: A fast and fully-mergeable quantile sketch with relative-error guarantees", 2019)
+ * so that the quantile of any rank is returned with a relative error not larger than the one
+ * requested at construction. Sketches with the same relative accuracy can be merged losslessly.
+ */
+class quantile_sketch {
+  class store {
+    std::vector<std::uint64_t> bins_;
+    int offset_ = 0;
+
+  public:
+    [[nodiscard]] std::uint64_t count() const noexcept
+    {
+      std::uint64_t count = 0;
+      for (const std::uint64_t n : bins_) count += n;
+      return count;
+    }
+
+    void add(int key, std::uint64_t n)
+    {
+      if (bins_.empty()) {
+        offset_ = key;
+        bins_.push_back(0);
+      }
+      else if (key < offset_) {
+        bins_.insert(bins_.begin(), static_cast<std::size_t>(offset_ - key), 0);
+        offset_ = key;
+      }
+      else if (key >= offset_ + static_cast<int>(bins_.size())) {
+        bins_.resize(static_cast<std::size_t>(key - offset_ + 1), 0);
+      }
+      bins_[static_cast<std::size_t>(key - offset_)] += n;
+    }
+
+    void merge(const store& other)
+    {
+      for (std::size_t i = 0; i < other.bins_.size(); ++i) {
+        if (other.bins_[i] != 0) add(other.offset_ + static_cast<int>(i), other.bins_[i]);
+      }
+    }
+
+    // the key of the bucket containing the value of the given rank (counted from the lowest key)
+    [[nodiscard]] int key_at_rank(double rank) const noexcept
+    {
+      double count = 0;
+      for (std::size_t i = 0; i < bins_.size(); ++i) {
+        count += static_cast<double>(bins_[i]);
+        if (count > rank) return offset_ + static_cast<int>(i);
+      }
+      return offset_ + static_cast<int>(bins_.size()) - 1;
+    }
+  };
+
+  double relative_accuracy_;
+  double gamma_;
+  double log_gamma_;
+  store positive_;
+  store negative_;
+  std::uint64_t zero_count_ = 0;
+
+  [[nodiscard]] int key(double v) const { return static_cast<int>(std::ceil(std::log(v) / log_gamma_)); }
+  [[nodiscard]] double value(int key) const { return 2 * std::pow(gamma_, key) / (gamma_ + 1); }
+
+public:
+  explicit quantile_sketch(double relative_accuracy) :
+      relative_accuracy_(relative_accuracy),
+      gamma_((1 + relative_accuracy) / (1 - relative_accuracy)),
+      log_gamma_(std::log(gamma_))
+  {
+    Expects(relative_accuracy > 0 && relative_accuracy < 1);
+  }
+
+  [[nodiscard]] double relative_accuracy() const noexcept { return relative_accuracy_; }
+
+  void add(double v)
+  {
+    // values too small to be distinguished from zero with the given accuracy are counted as zeros
+    if (v > std::numeric_limits<double>::min())
+      positive_.add(key(v), 1);
+    else if (v < -std::numeric_limits<double>::min())
+      negative_.add(key(-v), 1);
+    else
+      ++zero_count_;
+  }
+
+  void merge(const quantile_sketch& other)
+  {
+    Expects(relative_accuracy_ == other.relative_accuracy_);
+    positive_.merge(other.positive_);
+    negative_.merge(other.negative_);
+    zero_count_ += other.zero_count_;
+  }
+
+  [[nodiscard]] double quantile(double q) const
+  {
+    Expects(q >= 0 && q <= 1);
+    const std::uint64_t negative_count = negative_.count();
+    const std::uint64_t count = negative_count + zero_count_ + positive_.count();
+    Expects(count > 0);
+
+    const double rank = q * static_cast<double>(count - 1);
+    if (rank < static_cast<double>(negative_count)) {
+      return -value(negative_.key_at_rank(static_cast<double>(negative_count) - 1 - rank));
+    }
+    if (rank < static_cast<double>(negative_count + zero_count_)) {
+      return 0;
+    }
+    return value(positive_.key_at_rank(rank - static_cast<double>(negative_count + zero_count_)));
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A streaming accumulator of statistics of quantities
+ *
+ * Computes in a single pass and in constant memory (except of a quantile sketch which grows
+ * logarithmically with the range of values):
+ * - the number of samples, their minimum and maximum,
+ * - a compensated (Neumaier) sum,
+ * - a mean and a variance (Welford's online algorithm),
+ * - approximate quantiles with a configurable relative accuracy.
+ *
+ * All results are quantities of a proper dimension (i.e. a variance of speeds is a quantity of
+ * the dimension of speed squared). Values are accumulated with at least the precision of @c double
+ * (`std::common_type_t<rep, double>`) and converted to the representation type of the results
+ * only in the accessors.
+ *
+ * Accumulators filled independently (i.e. by different threads) can be combined with @c merge()
+ * giving the same results as if all the samples were added to a single one.
+ *
+ * @tparam Q a type of quantities to accumulate
+ */
+template<Quantity Q>
+class statistics {
+public:
+  using quantity_type = Q;
+  using dimension = TYPENAME Q::dimension;
+  using unit = TYPENAME Q::unit;
+  using rep = std::conditional_t<treat_as_floating_point<typename Q::rep>, typename Q::rep, double>;
+  using value_type = quantity<dimension, unit, rep>;
+  using variance_type = quantity<dimension_pow<dimension, 2>, downcast_unit<dimension_pow<dimension, 2>, pow<2>(unit::ratio)>, rep>;
+
+  static constexpr double default_relative_accuracy = 0.01;
+
+private:
+  using accumulator_type = std::common_type_t<rep, double>;
+
+  std::uint64_t count_ = 0;
+  accumulator_type sum_{};
+  accumulator_type compensation_{};
+  accumulator_type mean_{};
+  accumulator_type m2_{};
+  Q min_{};
+  Q max_{};
+  detail::quantile_sketch sketch_;
+
+  void add_to_sum(accumulator_type v)
+  {
+    const accumulator_type t = sum_ + v;
+    if (std::abs(sum_) >= std::abs(v))
+      compensation_ += (sum_ - t) + v;
+    else
+      compensation_ += (v - t) + sum_;
+    sum_ = t;
+  }
+
+public:
+  explicit statistics(double relative_accuracy = default_relative_accuracy) : sketch_(relative_accuracy) {}
+
+  void add(const Q& q)
+  {
+    const accumulator_type v = static_cast<accumulator_type>(q.count());
+    if (count_ == 0) {
+      min_ = max_ = q;
+    }
+    else {
+      min_ = std::min(min_, q);
+      max_ = std::max(max_, q);
+    }
+    ++count_;
+    add_to_sum(v);
+    const accumulator_type delta = v - mean_;
+    mean_ += delta / static_cast<accumulator_type>(count_);
+    m2_ += delta * (v - mean_);
+    sketch_.add(static_cast<double>(v));
+  }
+
+  void operator()(const Q& q) { add(q); }
+
+  /**
+   * @brief Combines samples of another accumulator with the ones of this accumulator
+   *
+   * Uses the parallel algorithm of Chan et al. for the mean and the variance.
+   */
+  void merge(const statistics& other)
+  {
+    if (other.count_ == 0) return;
+    if (count_ == 0) {
+      *this = other;
+      return;
+    }
+
+    const accumulator_type n_a = static_cast<accumulator_type>(count_);
+    const accumulator_type n_b = static_cast<accumulator_type>(other.count_);
+    const accumulator_type n = n_a + n_b;
+    const accumulator_type delta = other.mean_ - mean_;
+    mean_ += delta * n_b / n;
+    m2_ += other.m2_ + delta * delta * n_a * n_b / n;
+    count_ += other.count_;
+
+    add_to_sum(other.sum_);
+    add_to_sum(other.compensation_);
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    sketch_.merge(other.sketch_);
+  }
+
+  [[nodiscard]] std::uint64_t count() const noexcept { return count_; }
+  [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+
+  [[nodiscard]] value_type sum() const noexcept { return value_type(static_cast<rep>(sum_ + compensation_)); }
+
+  [[nodiscard]] Q min() const
+  {
+    Expects(count_ > 0);
+    return min_;
+  }
+
+  [[nodiscard]] Q max() const
+  {
+    Expects(count_ > 0);
+    return max_;
+  }
+
+  [[nodiscard]] value_type mean() const
+  {
+    Expects(count_ > 0);
+    return value_type(static_cast<rep>(mean_));
+  }
+
+  /**
+   * @brief A population variance of samples
+   */
+  [[nodiscard]] variance_type variance() const
+  {
+    Expects(count_ > 0);
+    return variance_type(static_cast<rep>(m2_ / static_cast<accumulator_type>(count_)));
+  }
+
+  /**
+   * @brief An unbiased sample variance of samples (with Bessel's correction)
+   */
+  [[nodiscard]] variance_type sample_variance() const
+  {
+    Expects(count_ > 1);
+    return variance_type(static_cast<rep>(m2_ / static_cast<accumulator_type>(count_ - 1)));
+  }
+
+  [[nodiscard]] value_type stddev() const { return value_type(std::sqrt(variance().count())); }
+  [[nodiscard]] value_type sample_stddev() const { return value_type(std::sqrt(sample_variance().count())); }
+
+  /**
+   * @brief An approximate quantile of samples
+   *
+   * @param q a rank of a quantile in [0, 1] range (i.e. 0.5 for a median)
+   * @return a value with a relative error not larger than the relative accuracy of the accumulator
+   *         clamped to the range of samples (exact minimum and maximum for 0 and 1)
+   */
+  [[nodiscard]] value_type quantile(double q) const
+  {
+    Expects(count_ > 0 && q >= 0 && q <= 1);
+    if (q == 0) return value_type(min_);
+    if (q == 1) return value_type(max_);
+    const rep v = static_cast<rep>(sketch_.quantile(q));
+    return value_type(std::clamp(v, static_cast<rep>(min_.count()), static_cast<rep>(max_.count())));
+  }
+};
+
+}  // namespace units
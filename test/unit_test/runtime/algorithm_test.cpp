@@ -0,0 +1,120 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/algorithm.h"
+#include "units/physical/si/derived/energy.h"
+#include "units/physical/si/derived/force.h"
+#include <catch2/catch.hpp>
+#include <array>
+#include <list>
+#include <vector>
+
+using namespace units;
+using namespace units::physical::si;
+
+TEST_CASE("'reduce()' sums quantities", "[algorithm][reduce]")
+{
+  const std::vector v{1_q_km, 2_q_km, 3_q_km};
+
+  SECTION ("the result has the type of the elements") {
+    CHECK(reduce(v) == 6_q_km);
+    static_assert(std::is_same_v<decltype(reduce(v)), length<kilometre, std::int64_t>>);
+  }
+
+  SECTION ("an initial value of a different unit gives a common unit") {
+    const auto sum = reduce(v, 5_q_m);
+    CHECK(sum == 6005_q_m);
+    static_assert(std::is_same_v<decltype(sum), const length<metre, std::int64_t>>);
+  }
+
+  SECTION ("non-contiguous ranges are supported") {
+    const std::list<length<centimetre, long double>> l{1._q_m, 2._q_cm};
+    CHECK(reduce(l) == 102._q_cm);
+  }
+
+#if defined(__cpp_lib_execution)
+  SECTION ("execution policies are supported") {
+    CHECK(reduce(std::execution::par_unseq, v) == 6_q_km);
+    CHECK(reduce(std::execution::seq, v, 1_q_m) == 6001_q_m);
+  }
+#endif
+}
+
+TEST_CASE("'transform_reduce()' sums products of quantities", "[algorithm][transform_reduce]")
+{
+  const std::array<force<newton, std::int64_t>, 3> forces{1_q_N, 2_q_kN, 3_q_N};
+  const std::array<length<millimetre, std::int64_t>, 3> displacements{10_q_m, 20_q_m, 30_q_mm};
+
+  SECTION ("forces and displacements give energy") {
+    const auto e = transform_reduce(forces, displacements);
+    static_assert(std::is_same_v<decltype(e)::dimension, dim_energy>);
+    CHECK(e == 40'010'090_q_mJ);
+  }
+
+  SECTION ("an initial value of a different unit gives a common unit") {
+    CHECK(transform_reduce(forces, displacements, 1_q_J) == 40'011'090_q_mJ);
+  }
+
+#if defined(__cpp_lib_execution)
+  SECTION ("execution policies are supported") {
+    CHECK(transform_reduce(std::execution::par_unseq, forces, displacements) == 40'010'090_q_mJ);
+  }
+#endif
+}
+
+TEST_CASE("'inclusive_scan()' stores partial sums of quantities", "[algorithm][inclusive_scan]")
+{
+  const std::vector<length<metre>> v{1._q_m, 2._q_m, 3._q_m};
+
+  SECTION ("the same quantity type") {
+    std::vector<length<metre>> out(v.size());
+    const auto it = inclusive_scan(v, out);
+    CHECK(it == out.end());
+    CHECK(out == std::vector<length<metre>>{1._q_m, 3._q_m, 6._q_m});
+  }
+
+  SECTION ("a different unit") {
+    std::vector<length<millimetre>> out(v.size());
+    inclusive_scan(v, out);
+    CHECK(out == std::vector<length<millimetre>>{1000._q_mm, 3000._q_mm, 6000._q_mm});
+  }
+
+#if defined(__cpp_lib_execution)
+  SECTION ("execution policies are supported") {
+    std::array<length<metre>, 3> out;
+    inclusive_scan(std::execution::par, v, out);
+    CHECK(out.back() == 6._q_m);
+  }
+#endif
+}
+
+TEST_CASE("'minmax()' finds the smallest and the largest quantity", "[algorithm][minmax]")
+{
+  const std::vector v{3._q_m, -2._q_m, 7._q_m, 0._q_m};
+  const auto [min, max] = minmax(v);
+  CHECK(min == -2._q_m);
+  CHECK(max == 7._q_m);
+
+#if defined(__cpp_lib_execution)
+  CHECK(minmax(std::execution::par_unseq, v) == std::pair(-2._q_m, 7._q_m));
+#endif
+}
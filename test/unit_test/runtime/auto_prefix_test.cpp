@@ -0,0 +1,100 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/auto_prefix.h"
+#include "units/data/data.h"
+#include "units/physical/si/si.h"
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <sstream>
+
+using namespace units;
+using namespace units::physical::si;
+
+namespace {
+
+template<typename T>
+std::string to_string(const T& v)
+{
+  std::ostringstream os;
+  os << v;
+  return os.str();
+}
+
+}  // namespace
+
+TEST_CASE("auto_prefix selects an SI prefix", "[auto_prefix]")
+{
+  CHECK(to_string(auto_prefix(4.7_q_V)) == "4.7 V");
+  CHECK(to_string(auto_prefix(0.0047_q_V)) == "4.7 mV");
+  CHECK(to_string(auto_prefix(-0.0047_q_V)) == "-4.7 mV");
+  CHECK(to_string(auto_prefix(0.00047_q_V)) == "470 µV");
+  CHECK(to_string(auto_prefix(4700._q_V)) == "4.7 kV");
+  CHECK(to_string(auto_prefix(1000._q_V)) == "1 kV");
+  CHECK(to_string(auto_prefix(999._q_V)) == "999 V");
+  CHECK(to_string(auto_prefix(1._q_V)) == "1 V");
+}
+
+TEST_CASE("auto_prefix rescales prefixed units", "[auto_prefix]")
+{
+  CHECK(to_string(auto_prefix(4700_q_mV)) == "4.7 V");
+  CHECK(to_string(auto_prefix(0.5_q_km)) == "500 m");
+  CHECK(to_string(auto_prefix(1500._q_g)) == "1.5 kg");
+}
+
+TEST_CASE("auto_prefix stays in the range of prefixes", "[auto_prefix]")
+{
+  CHECK(to_string(auto_prefix(voltage<volt>(1e-30))) == "1e-06 yV");
+  CHECK(to_string(auto_prefix(voltage<volt>(1e30))) == "1e+06 YV");
+  CHECK(to_string(auto_prefix(0._q_V)) == "0 V");
+  CHECK(auto_prefix(voltage<volt>(std::numeric_limits<double>::infinity())).standard_symbol() == "V");
+}
+
+TEST_CASE("auto_prefix selects a binary prefix", "[auto_prefix]")
+{
+  using namespace units::data;
+  CHECK(to_string(auto_prefix(1536_q_B)) == "1.5 KiB");
+  CHECK(to_string(auto_prefix(information<byte, std::int64_t>(3 * 1024 * 1024))) == "3 MiB");
+  CHECK(to_string(auto_prefix(1023_q_B)) == "1023 B");
+  CHECK(to_string(auto_prefix(information<byte, double>(0.5))) == "0.5 B");
+  CHECK(auto_prefix(1536_q_B).ascii_symbol() == "KiB");
+}
+
+TEST_CASE("auto_prefix provides ASCII symbols", "[auto_prefix]")
+{
+  const auto v = auto_prefix(0.00047_q_V);
+  CHECK(v.count() == Approx(470));
+  CHECK(v.ascii_symbol() == "uV");
+}
+
+TEST_CASE("auto_prefix output honors the stream width", "[auto_prefix]")
+{
+  std::ostringstream os;
+  os << '|' << std::setw(10) << auto_prefix(0.0047_q_V) << '|';
+  os << std::left << std::setfill('*') << std::setw(10) << auto_prefix(0.5_q_km) << '|';
+  os.imbue(std::locale(os.getloc(), new std::numpunct<char>));
+  os << std::right << std::setw(8) << auto_prefix(4700._q_V) << '|';
+  CHECK(os.str() == "|    4.7 mV|500 m*****|**4.7 kV|");
+}
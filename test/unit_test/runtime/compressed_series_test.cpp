@@ -0,0 +1,145 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/compressed_series.h"
+#include "units/physical/si/si.h"
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace units;
+using namespace units::physical::si;
+
+namespace {
+
+using milliseconds = units::physical::si::time<millisecond, std::int64_t>;
+using timestamp = quantity_point<dim_time, millisecond, std::int64_t>;
+
+std::vector<timestamp> make_timestamps(std::size_t count)
+{
+  std::vector<timestamp> res;
+  std::int64_t t = 1'600'000'000'000;
+  for (std::size_t i = 0; i < count; ++i) {
+    t += 1000 + static_cast<std::int64_t>(i % 7 == 0 ? i % 5 : 0);
+    res.emplace_back(milliseconds(t));
+  }
+  return res;
+}
+
+}  // namespace
+
+TEST_CASE("compressed_series of timestamps", "[compressed_series]")
+{
+  const auto timestamps = make_timestamps(10'000);
+  compressed_series<timestamp> series;
+  for (const auto& t : timestamps) series.push_back(t);
+
+  REQUIRE(series.size() == timestamps.size());
+  CHECK(series.block_count() == (timestamps.size() + series.block_size - 1) / series.block_size);
+  CHECK(series.memory_size() * 5 < timestamps.size() * sizeof(timestamp));
+  CHECK(series.front() == timestamps.front());
+  CHECK(series.back() == timestamps.back());
+
+  SECTION("random access") {
+    for (std::size_t i = 0; i < timestamps.size(); i += 37) REQUIRE(series[i] == timestamps[i]);
+  }
+
+  SECTION("streaming decode across blocks") {
+    std::vector<timestamp> buffer(1000);
+    for (std::size_t first = 0; first < timestamps.size(); first += buffer.size() - 1) {
+      const auto decoded = series.decode(first, std::span(buffer));
+      REQUIRE(decoded.size() == std::min(buffer.size(), timestamps.size() - first));
+      for (std::size_t i = 0; i < decoded.size(); ++i) REQUIRE(decoded[i] == timestamps[first + i]);
+    }
+  }
+
+  SECTION("decode to quantity_span") {
+    std::vector<milliseconds> buffer(300);
+    const quantity_span<milliseconds> decoded = series.decode(250, quantity_span<milliseconds>(buffer));
+    REQUIRE(decoded.size() == buffer.size());
+    for (std::size_t i = 0; i < decoded.size(); ++i) REQUIRE(decoded[i] == timestamps[250 + i].relative());
+  }
+}
+
+TEST_CASE("compressed_series stores values at the resolution of its unit", "[compressed_series]")
+{
+  compressed_series<timestamp> series;
+  series.push_back(quantity_point(units::physical::si::time<microsecond, std::int64_t>(1'500'999)));
+  series.push_back(quantity_point(units::physical::si::time<second, std::int64_t>(2)));
+  CHECK(series[0] == timestamp(milliseconds(1500)));
+  CHECK(series[1] == timestamp(milliseconds(2000)));
+}
+
+TEST_CASE("compressed_series of integral values does not overflow", "[compressed_series]")
+{
+  using metres = length<metre, std::int64_t>;
+  const std::vector<metres> values{metres(std::numeric_limits<std::int64_t>::min()), metres(std::numeric_limits<std::int64_t>::max()),
+                                   metres(0), metres(-1), metres(std::numeric_limits<std::int64_t>::min())};
+  compressed_series<metres, 4> series;
+  for (const auto& v : values) series.push_back(v);
+  for (std::size_t i = 0; i < values.size(); ++i) REQUIRE(series[i] == values[i]);
+
+  compressed_series<length<metre, std::uint8_t>> bytes;
+  bytes.push_back(length<metre, std::uint8_t>(255));
+  bytes.push_back(length<metre, std::uint8_t>(0));
+  CHECK(bytes[0].count() == 255);
+  CHECK(bytes[1].count() == 0);
+}
+
+TEST_CASE("compressed_series of floating-point values is lossless", "[compressed_series]")
+{
+  std::vector<thermodynamic_temperature<kelvin>> readings;
+  for (std::size_t i = 0; i < 5000; ++i)
+    readings.emplace_back(std::round((293.15 + std::sin(static_cast<double>(i) / 500.)) * 10) / 10);
+  readings.emplace_back(std::numeric_limits<double>::infinity());
+  readings.emplace_back(-0.);
+  readings.emplace_back(std::numeric_limits<double>::denorm_min());
+
+  compressed_series<thermodynamic_temperature<kelvin>> series;
+  for (const auto& r : readings) series.push_back(r);
+  CHECK(series.memory_size() * 3 < readings.size() * sizeof(double));
+
+  std::vector<thermodynamic_temperature<kelvin>> buffer(readings.size());
+  const auto decoded = series.decode(0, quantity_span<thermodynamic_temperature<kelvin>>(buffer));
+  REQUIRE(decoded.size() == readings.size());
+  for (std::size_t i = 0; i < readings.size(); ++i)
+    REQUIRE(std::bit_cast<std::uint64_t>(decoded[i].count()) == std::bit_cast<std::uint64_t>(readings[i].count()));
+
+  compressed_series<thermodynamic_temperature<kelvin, float>, 16> floats;
+  for (const auto& r : readings) floats.push_back(quantity_cast<thermodynamic_temperature<kelvin, float>>(r));
+  for (std::size_t i = 0; i < readings.size(); i += 3)
+    REQUIRE(floats[i].count() == static_cast<float>(readings[i].count()));
+}
+
+TEST_CASE("compressed_series clear", "[compressed_series]")
+{
+  compressed_series<length<metre, int>> series;
+  series.push_back(length<metre, int>(1));
+  series.push_back(length<metre, int>(2));
+  series.clear();
+  CHECK(series.empty());
+  CHECK(series.block_count() == 0);
+  series.push_back(length<metre, int>(3));
+  CHECK(series[0].count() == 3);
+}
@@ -0,0 +1,79 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/converter.h"
+#include <catch2/catch.hpp>
+#include <cstdint>
+
+using namespace units;
+using namespace units::physical;
+
+TEST_CASE("converter converts values of a unit known at runtime", "[converter]")
+{
+  const converter<si::length<si::metre>> from_km(unit_id<si::dim_length, si::kilometre>);
+  CHECK(from_km(2.5) == si::length<si::metre>(2500));
+  CHECK(from_km.factor() == 1000);
+
+  const converter<si::length<si::metre>> from_ft(unit_id<si::fps::dim_length, si::fps::foot>);
+  CHECK(from_ft(10).count() == Approx(3.048));
+
+  const converter<si::speed<si::metre_per_second>> from_kmh(unit_id<si::dim_speed, si::kilometre_per_hour>);
+  CHECK(from_kmh(36).count() == Approx(10));
+}
+
+TEST_CASE("converter converts units of other systems", "[converter]")
+{
+  const converter<si::energy<si::joule>> from_ftlbf(unit_id<si::fps::dim_energy, si::fps::foot_pound_force>);
+  CHECK(from_ftlbf(1).count() == Approx(1.3558179483));
+
+  const converter<si::force<si::newton>> from_dyn(unit_id<si::cgs::dim_force, si::cgs::dyne>);
+  CHECK(from_dyn(1e5).count() == Approx(1));
+}
+
+TEST_CASE("converter uses the exact integral scaling for integral representations", "[converter]")
+{
+  using power = si::power<si::watt, long>;
+  const converter<power> from_kw(unit_id<si::dim_power, si::kilowatt>);
+  CHECK(from_kw(3) == power(3000));
+
+  const converter<power> from_mw(unit_id<si::dim_power, si::milliwatt>);
+  CHECK(from_mw(4999) == power(4));
+  CHECK(from_mw(-4999) == power(-4));
+  CHECK(from_mw.factor().divisor == 1000);
+
+  using length = si::length<si::metre, std::int64_t>;
+  const converter<length> from_us_ft(unit_id<si::dim_length, si::us::foot>);
+  CHECK(from_us_ft(9'223'372'036'854'775'802).count() == 2'811'289'419'412'174'488);
+  CHECK(from_us_ft(-9'223'372'036'854'775'802).count() == -2'811'289'419'412'174'488);
+
+  CHECK_FALSE(converter<power>::contains(unit_id<si::dim_power, si::yoctowatt>));
+  CHECK_FALSE(converter<power>::contains(unit_id<si::fps::dim_power, si::fps::foot_pound_force_per_second>));
+}
+
+TEST_CASE("converter rejects units of other dimensions", "[converter]")
+{
+  using length = si::length<si::metre>;
+  CHECK(converter<length>::contains(unit_id<si::dim_length, si::metre>));
+  CHECK_FALSE(converter<length>::contains(unit_id<si::dim_time, si::second>));
+  CHECK_FALSE(converter<length>::contains(0));
+  CHECK_THROWS_AS(converter<length>(unit_id<si::dim_time, si::second>), std::invalid_argument);
+}
@@ -0,0 +1,92 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/dynamic_quantity.h"
+#include "units/physical/si/cgs/cgs.h"
+#include "units/physical/si/si.h"
+#include <catch2/catch.hpp>
+#include <stdexcept>
+
+using namespace units;
+using namespace units::physical::si;
+
+TEST_CASE("packed_dimension", "[dynamic_quantity]")
+{
+  constexpr auto length = packed_dimension::of<dim_length>();
+  constexpr auto time = packed_dimension::of<dim_time>();
+  constexpr auto speed = packed_dimension::of<dim_speed>();
+
+  static_assert(length / time == speed);
+  static_assert(speed * time == length);
+  static_assert(length / length == packed_dimension());
+  static_assert(packed_dimension::of<dim_acceleration>() == speed / time);
+  static_assert(packed_dimension::of<dim_energy>() ==
+                packed_dimension::of<dim_force>() * length);
+  static_assert(packed_dimension::of<cgs::dim_length>() == length);
+  static_assert(length != time);
+
+  CHECK(speed.exponent("L") == 1);
+  CHECK(speed.exponent("T") == -1);
+  CHECK(packed_dimension::of<dim_power>().exponent("T") == -3);
+  CHECK((packed_dimension() / packed_dimension::of<dim_power>() * time).exponent("T") == 4);
+  CHECK(speed.exponent("M") == 0);
+}
+
+TEST_CASE("dynamic_quantity arithmetic", "[dynamic_quantity]")
+{
+  const dynamic_quantity d = 2_q_km;
+  const dynamic_quantity t = 4_q_s;
+
+  const auto v = d / t;
+  CHECK(v.dimension() == packed_dimension::of<dim_speed>());
+  CHECK(quantity_cast<speed<metre_per_second>>(v).count() == Approx(500));
+  CHECK(quantity_cast<speed<kilometre_per_hour>>(v).count() == Approx(1800));
+
+  const auto sum = d + dynamic_quantity(500_q_m);
+  CHECK(quantity_cast<length<metre>>(sum).count() == Approx(2500));
+  CHECK(quantity_cast<length<kilometre>>(-sum * 2.).count() == Approx(-5));
+
+  CHECK(dynamic_quantity(1_q_km) == dynamic_quantity(1000_q_m));
+  CHECK(dynamic_quantity(1_q_km) > dynamic_quantity(999_q_m));
+  CHECK(dynamic_quantity(2_q_m) * dynamic_quantity(3_q_m) == dynamic_quantity(6_q_m2));
+  CHECK(quantity_cast<force<newton>>(dynamic_quantity(2_q_kg) * dynamic_quantity(3_q_m_per_s2)).count() == Approx(6));
+}
+
+TEST_CASE("dynamic_quantity dimensions are checked", "[dynamic_quantity]")
+{
+  const dynamic_quantity d = 2_q_km;
+  const dynamic_quantity t = 4_q_s;
+
+  CHECK_THROWS_AS(d + t, std::invalid_argument);
+  CHECK_THROWS_AS(d < t, std::invalid_argument);
+  CHECK_THROWS_AS(quantity_cast<units::physical::si::time<second>>(d), std::invalid_argument);
+  CHECK_NOTHROW(quantity_cast<units::physical::si::time<second>>(d / (d / t)));
+}
+
+TEST_CASE("dynamic_quantity with systems having different base units", "[dynamic_quantity]")
+{
+  const dynamic_quantity cgs_speed = cgs::speed<cgs::centimetre_per_second>(100);
+  CHECK(quantity_cast<speed<metre_per_second>>(cgs_speed).count() == Approx(1));
+
+  const dynamic_quantity mass = 2_q_kg;
+  CHECK(quantity_cast<cgs::mass<gram>>(mass).count() == Approx(2000));
+}
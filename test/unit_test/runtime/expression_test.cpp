@@ -0,0 +1,127 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/expression.h"
+#include <catch2/catch.hpp>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace units;
+using namespace units::physical;
+
+namespace {
+
+const unit_info& find_unit(std::string_view symbol)
+{
+  const unit_info* u = registry::find(symbol);
+  if (u == nullptr) throw std::invalid_argument("unknown unit");
+  return *u;
+}
+
+}  // namespace
+
+TEST_CASE("compile_expression folds unit conversions", "[expression]")
+{
+  const auto e = compile_expression("(distance / 20 min) * 1.2", {{"distance", find_unit("km")}},
+                                    registry::find("km/h"));
+  CHECK(e.dimension() == packed_dimension::of<si::dim_speed>());
+  CHECK(e.size() == 1);
+
+  const double distance[] = {10};
+  const dynamic_quantity v = e(std::span<const double>(distance));
+  CHECK(v.value() == Approx(36));
+  CHECK(quantity_cast<si::speed<si::metre_per_second>>(v).count() == Approx(10));
+}
+
+TEST_CASE("compile_expression evaluates dynamic quantities", "[expression]")
+{
+  const auto e = compile_expression("a * b + 3 m^2 - -c / 2", {{"a", find_unit("m")},
+                                                              {"b", find_unit("cm")},
+                                                              {"c", find_unit("m²")}});
+  CHECK(e.dimension() == packed_dimension::of<si::dim_area>());
+
+  const double values[] = {2, 50, 4};
+  CHECK(e(std::span<const double>(values)).base_value() == Approx(6));
+
+  const dynamic_quantity quantities[] = {si::length<si::kilometre>(0.002), si::length<si::metre>(0.5),
+                                         si::area<si::square_metre>(4)};
+  CHECK(e(std::span<const dynamic_quantity>(quantities)).base_value() == Approx(6));
+
+  const dynamic_quantity wrong[] = {si::time<si::second>(1), si::length<si::metre>(0.5), si::area<si::square_metre>(4)};
+  CHECK_THROWS_AS(e(std::span<const dynamic_quantity>(wrong)), std::invalid_argument);
+}
+
+TEST_CASE("compile_expression evaluates batches", "[expression]")
+{
+  const auto e = compile_expression("(energy - 1 kJ) / duration", {{"energy", find_unit("J")},
+                                                                   {"duration", find_unit("min")}},
+                                    registry::find("W"));
+  CHECK(e.dimension() == packed_dimension::of<si::dim_power>());
+
+  std::vector<double> energy(1000), duration(1000), result(1000);
+  for (std::size_t i = 0; i < energy.size(); ++i) {
+    energy[i] = 1000 + 60. * static_cast<double>(i);
+    duration[i] = 1 + static_cast<double>(i % 3);
+  }
+  const std::span<const double> columns[] = {energy, duration};
+  e.evaluate(columns, result);
+
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    const double sample[] = {energy[i], duration[i]};
+    REQUIRE(result[i] == Approx(static_cast<double>(i) / duration[i]));
+    REQUIRE(result[i] == e(std::span<const double>(sample)).value());
+  }
+}
+
+TEST_CASE("compile_expression supports unit symbols alone", "[expression]")
+{
+  const auto e = compile_expression("2 km/h * h", {}, registry::find("m"));
+  CHECK(e.size() == 1);
+  CHECK(e(std::span<const double>()).value() == Approx(2000));
+}
+
+TEST_CASE("compile_expression rejects invalid expressions", "[expression]")
+{
+  CHECK_THROWS_AS(compile_expression("1 m + 1 s"), std::invalid_argument);
+  CHECK_THROWS_AS(compile_expression("(1 m"), std::invalid_argument);
+  CHECK_THROWS_AS(compile_expression("1 m +"), std::invalid_argument);
+  CHECK_THROWS_AS(compile_expression("2 xyz"), std::invalid_argument);
+  CHECK_THROWS_AS(compile_expression("20 °C"), std::invalid_argument);
+  CHECK_THROWS_AS(compile_expression("distance / 2"), std::invalid_argument);
+  CHECK_THROWS_AS(compile_expression("1 m", {}, registry::find("s")), std::invalid_argument);
+}
+
+TEST_CASE("compile_expression handles long chains of operators", "[expression]")
+{
+  // a left-deep tree of 200'000 operators
+  std::string text = "x";
+  for (int i = 0; i < 100'000; ++i) text += " * x / x";
+  text += " * 2";
+  const auto e = compile_expression(text, {{"x", find_unit("m")}});
+  CHECK(e.dimension() == packed_dimension::of<si::dim_length>());
+  CHECK(e.size() == 400'001);
+
+  const double x[] = {3};
+  CHECK(e(std::span<const double>(x)).base_value() == Approx(6));
+}
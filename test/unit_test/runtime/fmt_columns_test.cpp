@@ -0,0 +1,56 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/format_columns.h>
+#include <units/physical/si/si.h>
+#include <catch2/catch.hpp>
+#include <array>
+#include <vector>
+
+using namespace units;
+using namespace units::physical::si;
+
+TEST_CASE("format_columns", "[text][fmt]")
+{
+  const std::vector<physical::si::time<second>> t{0_q_s, 1.5_q_s, 3_q_s};
+  const std::array<length<kilometre, int>, 3> d{0_q_km, 12_q_km, 25_q_km};
+  const std::vector<speed<metre_per_second>> v{0._q_m_per_s, 22.25_q_m_per_s, 23.5_q_m_per_s};
+  fmt::memory_buffer buf;
+
+  SECTION("default format")
+  {
+    format_columns(buf, {}, t, d, v);
+    CHECK(fmt::to_string(buf) == "s,km,m/s\n0,0,0\n1.5,12,22.25\n3,25,23.5\n");
+  }
+
+  SECTION("custom format")
+  {
+    format_columns(buf, {.value_spec = "%.1Q", .delimiter = ";", .header = false}, t, v);
+    CHECK(fmt::to_string(buf) == "0.0;0.0\n1.5;22.2\n3.0;23.5\n");
+  }
+
+  SECTION("rows are written until the shortest range is exhausted")
+  {
+    format_columns(buf, {.value_spec = "%Q %q"}, d, std::vector{1_q_m});
+    CHECK(fmt::to_string(buf) == "km,m\n0 km,1 m\n");
+  }
+}
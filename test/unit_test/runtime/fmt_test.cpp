@@ -20,13 +20,16 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <units/auto_prefix.h>
 #include <units/format.h>
 #include <units/math.h>
 #include <units/physical/si/si.h>
 #include <units/physical/si/cgs/cgs.h>
 #include <units/quantity_io.h>
 #include <catch2/catch.hpp>
+#include <fmt/compile.h>
 #include <iomanip>
+#include <iterator>
 #include <sstream>
 
 using namespace units;
@@ -880,6 +883,64 @@ TEST_CASE("%q and %Q can be put anywhere in a format string", "[text][fmt]")
   }
 }
 
+TEST_CASE("ostream formatting flags", "[text][ostream]")
+{
+  std::ostringstream os;
+
+  SECTION("precision")
+  {
+    os << std::setprecision(3) << 1.2345_q_m << ";" << std::setprecision(0) << 1.2345_q_m;
+    CHECK(os.str() == "1.23 m;1 m");
+  }
+
+  SECTION("large precision")
+  {
+    os << std::setprecision(200) << 0.5_q_m;
+    CHECK(os.str() == "0.5 m");
+  }
+
+  SECTION("fixed")
+  {
+    os << std::fixed << std::setprecision(2) << 1.2345_q_m;
+    CHECK(os.str() == "1.23 m");
+  }
+
+  SECTION("showpos")
+  {
+    os << std::showpos << 123_q_m;
+    CHECK(os.str() == "+123 m");
+  }
+
+  SECTION("hex")
+  {
+    os << std::hex << 255_q_m;
+    CHECK(os.str() == "ff m");
+  }
+
+  SECTION("internal")
+  {
+    os << "|" << std::setw(10) << std::internal << -123_q_m << "|";
+    CHECK(os.str() == "|    -123 m|");
+  }
+
+  SECTION("non-classic locale")
+  {
+    struct group3 : std::numpunct<char> {
+      char do_thousands_sep() const override { return '\''; }
+      std::string do_grouping() const override { return "\3"; }
+    };
+    os.imbue(std::locale(std::locale::classic(), new group3));
+    os << 299792458_q_m_per_s;
+    CHECK(os.str() == "299'792'458 m/s");
+  }
+
+  SECTION("width is reset")
+  {
+    os << std::setw(6) << 1_q_m << 1_q_m;
+    CHECK(os.str() == "   1 m1 m");
+  }
+}
+
 TEST_CASE("fill and align specification", "[text][fmt][ostream]")
 {
   SECTION("ostream")
@@ -970,6 +1031,24 @@ TEST_CASE("fill and align specification", "[text][fmt][ostream]")
     CHECK(fmt::format("|{:*>10%q}|", 123_q_m) == "|*********m|");
     CHECK(fmt::format("|{:*^10%q}|", 123_q_m) == "|****m*****|");
   }
+
+  SECTION("dynamic width")
+  {
+    CHECK(fmt::format("|{:{}}|", 123_q_m, 10) == "|     123 m|");
+    CHECK(fmt::format("|{:*<{}%Q%q}|", 123_q_m, 10) == "|123m******|");
+  }
+
+  SECTION("non-ASCII unit symbol")
+  {
+    CHECK(fmt::format("|{:>10}|", 123_q_um) == "|    123 µm|");
+    CHECK(fmt::format("|{:*^10%Q%q}|", 123_q_um) == "|**123µm***|");
+  }
+}
+
+TEST_CASE("format with many units-specs", "[text][fmt]")
+{
+  CHECK(fmt::format("{:%Q %q|%Q %q|%Q %q|%Q %q|%Q %q|%Q %q}", 1_q_m) == "1 m|1 m|1 m|1 m|1 m|1 m");
+  CHECK(fmt::format("|{:*^30%Q %q|%Q %q|%Q %q|%Q %q|%Q %q}|", 1_q_m) == "|*****1 m|1 m|1 m|1 m|1 m******|");
 }
 
 TEST_CASE("sign specification", "[text][fmt]")
@@ -1025,6 +1104,12 @@ TEST_CASE("precision specification", "[text][fmt]")
     CHECK(fmt::format("{:%.5Q}", 1.2345_q_m) == "1.23450");
     CHECK(fmt::format("{:%.10Q}", 1.2345_q_m) == "1.2345000000");
   }
+
+  SECTION("dynamic precision")
+  {
+    CHECK(fmt::format("{:%.{}Q %q}", 1.2345_q_m, 2) == "1.23 m");
+    CHECK(fmt::format("{:%.{}Q %q}", 1.2345_q_m, 4) == "1.2345 m");
+  }
 }
 
 TEST_CASE("precision specification for integral representation should throw", "[text][fmt][exception]")
@@ -1156,6 +1241,37 @@ TEST_CASE("localization with the 'L' specifier", "[text][fmt][localization]")
   }
 }
 
+TEST_CASE("auto_prefix", "[text][fmt]")
+{
+  CHECK(fmt::format("{}", auto_prefix(0.0047_q_V)) == "4.7 mV");
+  CHECK(fmt::format("{:%.1Q %q}", auto_prefix(4567._q_m)) == "4.6 km");
+  CHECK(fmt::format("{:%Q %Aq}", auto_prefix(0.00047_q_V)) == "470 uV");
+  CHECK(fmt::format("|{:*^10}|", auto_prefix(0.0047_q_V)) == "|**4.7 mV**|");
+}
+
+TEST_CASE("format string compiled with FMT_COMPILE", "[text][fmt]")
+{
+  SECTION("default format {} on a quantity")
+  {
+    CHECK(fmt::format(FMT_COMPILE("{}"), 123_q_m) == "123 m");
+    CHECK(fmt::format(FMT_COMPILE("{}"), 125_q_us) == "125 µs");
+  }
+
+  SECTION("full format {:%Q %q} on a quantity")
+  {
+    CHECK(fmt::format(FMT_COMPILE("{:%.2Q %q}"), 1.2345_q_m) == "1.23 m");
+    CHECK(fmt::format(FMT_COMPILE("{:%Q %Aq}"), 125_q_us) == "125 us");
+    CHECK(fmt::format(FMT_COMPILE("|{:*^10%Q%q}|"), 123_q_m) == "|***123m***|");
+  }
+
+  SECTION("format_to")
+  {
+    fmt::memory_buffer buf;
+    fmt::format_to(std::back_inserter(buf), FMT_COMPILE("{:%.1Q %q}, {}"), 3.25_q_km_per_h, 2_q_s);
+    CHECK(fmt::to_string(buf) == "3.2 km/h, 2 s");
+  }
+}
+
 TEST_CASE("quantity_cast", "[text][ostream]")
 {
   std::ostringstream os;
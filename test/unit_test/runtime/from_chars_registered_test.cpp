@@ -0,0 +1,63 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "units/from_chars_registered.h"
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+using namespace units;
+using namespace units::physical::si;
+
+namespace {
+
+template<typename Q>
+auto parse(std::string_view str, Q& q)
+{
+  return from_chars_registered(str.data(), str.data() + str.size(), q);
+}
+
+}  // namespace
+
+TEST_CASE("from_chars_registered parses a quantity in any registered unit", "[text][from_chars]")
+{
+  SECTION("units of the dimension")
+  {
+    length<metre, int> q;
+    CHECK(parse("12 km", q).ec == std::errc());
+    CHECK(q == 12000_q_m);
+    CHECK(parse("7 m", q).ec == std::errc());
+    CHECK(q == 7_q_m);
+    CHECK(parse("2 mi(us)", q).ec == std::errc());
+    CHECK(q == 3218_q_m);
+  }
+
+  SECTION("units of other systems")
+  {
+    using namespace units::data;
+    information<bit, std::int64_t> q;
+    CHECK(parse("2 KiB", q).ec == std::errc());
+    CHECK(q == 16384_q_b);
+  }
+}
@@ -0,0 +1,194 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/from_chars.h"
+#include "units/data/data.h"
+#include "units/physical/si/international/international.h"
+#include "units/physical/si/si.h"
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+using namespace units;
+using namespace units::physical::si;
+
+namespace {
+
+template<typename Q, typename... Units>
+auto parse(std::string_view str, Q& q)
+{
+  return from_chars<Q, Units...>(str.data(), str.data() + str.size(), q);
+}
+
+}  // namespace
+
+TEST_CASE("from_chars parses a quantity", "[text][from_chars]")
+{
+  SECTION("unit of the quantity")
+  {
+    length<metre> q;
+    const std::string_view str = "12.5 m";
+    const auto res = parse(str, q);
+    CHECK(res.ec == std::errc());
+    CHECK(res.ptr == str.data() + str.size());
+    CHECK(q == 12.5_q_m);
+  }
+
+  SECTION("no space between a number and a symbol")
+  {
+    length<metre, int> q;
+    CHECK(parse("-3m", q).ec == std::errc());
+    CHECK(q == -3_q_m);
+  }
+
+  SECTION("conversion from another unit")
+  {
+    speed<metre_per_second> q;
+    CHECK(parse<speed<metre_per_second>, kilometre_per_hour>("36 km/h", q).ec == std::errc());
+    CHECK(q == 10._q_m_per_s);
+  }
+
+  SECTION("standard and ASCII symbols")
+  {
+    physical::si::time<microsecond, int> q;
+    CHECK(parse<physical::si::time<microsecond, int>, millisecond>("2 µs", q).ec == std::errc());
+    CHECK(q == 2_q_us);
+    CHECK(parse<physical::si::time<microsecond, int>, millisecond>("3 us", q).ec == std::errc());
+    CHECK(q == 3_q_us);
+    CHECK(parse<physical::si::time<microsecond, int>, millisecond>("4 ms", q).ec == std::errc());
+    CHECK(q == 4000_q_us);
+  }
+
+  SECTION("only the unit of the quantity by default")
+  {
+    length<metre, int> q;
+    CHECK(parse("7 m", q).ec == std::errc());
+    CHECK(q == 7_q_m);
+    CHECK(parse("12 km", q).ec == std::errc::invalid_argument);
+  }
+
+  SECTION("units of other systems")
+  {
+    length<international::foot, int> q;
+    CHECK(parse<length<international::foot, int>, international::yard, international::mile>("2 yd", q).ec == std::errc());
+    CHECK(q == length<international::foot, int>(6));
+  }
+
+  SECTION("symbols with spaces and exponents")
+  {
+    specific_heat_capacity<joule_per_kilogram_kelvin> c;
+    const std::string_view str = "4.2 J K^-1 kg^-1,1";
+    const auto res = parse(str, c);
+    CHECK(res.ec == std::errc());
+    CHECK(res.ptr == str.data() + 16);
+    CHECK(c == specific_heat_capacity<joule_per_kilogram_kelvin>(4.2));
+
+    CHECK(parse("4.2 J ⋅ K⁻¹ ⋅ kg⁻¹", c).ec == std::errc());
+    CHECK(c == specific_heat_capacity<joule_per_kilogram_kelvin>(4.2));
+  }
+
+  SECTION("data prefixes")
+  {
+    using namespace units::data;
+    information<byte, std::int64_t> q;
+    CHECK(parse<information<byte, std::int64_t>, kibibyte, mebibyte, gibibyte>("3 MiB", q).ec == std::errc());
+    CHECK(q == 3 * 1024 * 1024_q_B);
+  }
+
+  SECTION("the rest of the input is left unparsed")
+  {
+    length<metre, int> q;
+    const std::string_view str = "12 km,13 m";
+    const auto res = parse<length<metre, int>, kilometre>(str, q);
+    CHECK(res.ec == std::errc());
+    CHECK(res.ptr == str.data() + 5);
+    CHECK(q == 12000_q_m);
+  }
+}
+
+TEST_CASE("from_chars reports errors", "[text][from_chars]")
+{
+  length<metre, int> q = 1_q_m;
+
+  SECTION("invalid number")
+  {
+    const std::string_view str = "abc m";
+    const auto res = parse(str, q);
+    CHECK(res.ec == std::errc::invalid_argument);
+    CHECK(res.ptr == str.data());
+  }
+
+  SECTION("number out of range")
+  {
+    CHECK(parse("99999999999 m", q).ec == std::errc::result_out_of_range);
+  }
+
+  SECTION("converted value out of range")
+  {
+    CHECK(parse<length<metre, int>, kilometre>("2147484 km", q).ec == std::errc::result_out_of_range);
+    CHECK(parse<length<metre, int>, kilometre>("-2147484 km", q).ec == std::errc::result_out_of_range);
+
+    length<metre, std::int16_t> s = 1_q_m;
+    CHECK(parse<length<metre, std::int16_t>, kilometre>("40 km", s).ec == std::errc::result_out_of_range);
+    CHECK(parse<length<metre, std::int16_t>, kilometre>("-33 km", s).ec == std::errc::result_out_of_range);
+    CHECK(s == 1_q_m);
+    CHECK(parse<length<metre, std::int16_t>, kilometre>("32 km", s).ec == std::errc());
+    CHECK(s == 32000_q_m);
+    CHECK(parse<length<metre, std::int16_t>, kilometre>("-32 km", s).ec == std::errc());
+    CHECK(s == -32000_q_m);
+
+    length<metre, std::int64_t> l;
+    CHECK(parse<length<metre, std::int64_t>, kilometre>("9223372036854776 km", l).ec == std::errc::result_out_of_range);
+    CHECK(parse<length<metre, std::int64_t>, kilometre>("9223372036854775 km", l).ec == std::errc());
+    CHECK(l == length<metre, std::int64_t>(9'223'372'036'854'775'000));
+
+    length<metre, std::uint8_t> u;
+    CHECK(parse<length<metre, std::uint8_t>, decametre>("26 dam", u).ec == std::errc::result_out_of_range);
+    CHECK(parse<length<metre, std::uint8_t>, decametre>("25 dam", u).ec == std::errc());
+    CHECK(u == length<metre, std::uint8_t>(250));
+
+    length<metre> d;
+    CHECK(parse<length<metre>, kilometre>("1e306 km", d).ec == std::errc::result_out_of_range);
+  }
+
+  SECTION("unknown unit symbol")
+  {
+    const std::string_view str = "12 km";
+    const auto res = parse<length<metre, int>, metre>(str, q);
+    CHECK(res.ec == std::errc::invalid_argument);
+    CHECK(res.ptr == str.data());
+  }
+
+  SECTION("symbol prefix is not a match")
+  {
+    CHECK(parse<length<metre, int>, kilometre>("12 mm", q).ec == std::errc::invalid_argument);
+    CHECK(parse<length<metre, int>, kilometre>("12 km/h", q).ec == std::errc::invalid_argument);
+  }
+
+  SECTION("missing symbol")
+  {
+    CHECK(parse("12", q).ec == std::errc::invalid_argument);
+  }
+
+  CHECK(q == 1_q_m);
+}
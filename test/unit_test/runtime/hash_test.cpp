@@ -0,0 +1,63 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/hash.h"
+#include "units/physical/si/si.h"
+#include <catch2/catch.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace units;
+using namespace units::physical::si;
+
+TEST_CASE("std::hash of a quantity", "[hash]")
+{
+  const std::hash<length<metre>> hash;
+  CHECK(hash(2._q_m) == hash(2._q_m));
+  CHECK(hash(2._q_m) != hash(3._q_m));
+
+  std::unordered_set<length<metre, int>> set{1_q_m, 2_q_m, 2_q_m, 3_q_m};
+  CHECK(set.size() == 3);
+  CHECK(set.contains(2_q_m));
+  CHECK(!set.contains(4_q_m));
+}
+
+TEST_CASE("std::hash of a quantity_point", "[hash]")
+{
+  using point = quantity_point<dim_length, metre, int>;
+  std::unordered_map<point, std::string> map;
+  map[point(1_q_m)] = "one";
+  map[point(2_q_m)] = "two";
+  CHECK(map.size() == 2);
+  CHECK(map.at(point(2_q_m)) == "two");
+}
+
+TEST_CASE("unit_id as a runtime dispatch key", "[hash]")
+{
+  std::unordered_map<std::uint64_t, std::string> names{
+    {unit_id<dim_length, metre>, "metre"},
+    {unit_id<dim_length, kilometre>, "kilometre"},
+    {unit_id<dim_time, second>, "second"}};
+  CHECK(names.size() == 3);
+  CHECK(names.at(unit_id<dim_length, kilometre>) == "kilometre");
+}
@@ -0,0 +1,188 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/mapped_series.h"
+#include "units/physical/si/cgs/cgs.h"
+#include "units/physical/si/si.h"
+#include "units/physical/si/us/base/length.h"
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+
+using namespace units;
+using namespace units::physical::si;
+
+namespace {
+
+struct temp_file {
+  std::filesystem::path path = std::filesystem::temp_directory_path() / "units_mapped_series_test.bin";
+  temp_file() { std::filesystem::remove(path); }
+  ~temp_file() { std::filesystem::remove(path); }
+};
+
+}  // namespace
+
+TEST_CASE("mapped_series reads the values written by series_writer", "[mapped_series]")
+{
+  temp_file file;
+  {
+    series_writer<length<metre>> writer(file.path);
+    writer.append(length<metre>(1));
+    writer.append(length<metre>(2));
+  }
+  {
+    series_writer<length<metre>> writer(file.path);
+    const std::vector<length<metre>> v = {length<metre>(3), length<metre>(4)};
+    writer.append(std::span(v));
+  }
+
+  const mapped_series<length<metre>> series(file.path);
+  REQUIRE(series.size() == 4);
+  CHECK(series.same_unit());
+  CHECK(series[0] == length<metre>(1));
+  CHECK(series[3] == length<metre>(4));
+
+  const auto q = series.quantities();
+  CHECK(q.size() == 4);
+  CHECK(q[2] == length<metre>(3));
+  CHECK(static_cast<const void*>(q.data()) == static_cast<const void*>(series.reps().data()));
+}
+
+TEST_CASE("mapped_series writes large sequences", "[mapped_series]")
+{
+  temp_file file;
+  std::vector<length<metre, std::int32_t>> v;
+  for (std::int32_t i = 0; i < 100'000; ++i) v.emplace_back(i);
+  {
+    series_writer<length<metre, std::int32_t>> writer(file.path);
+    writer.append(length<metre, std::int32_t>(-1));
+    writer.append(std::span(v));
+  }
+
+  const mapped_series<length<metre, std::int32_t>> series(file.path);
+  REQUIRE(series.size() == v.size() + 1);
+  CHECK(series[0].count() == -1);
+  CHECK(series[1].count() == 0);
+  CHECK(series[100'000].count() == 99'999);
+}
+
+TEST_CASE("mapped_series converts values written in a different unit", "[mapped_series]")
+{
+  temp_file file;
+  {
+    series_writer<length<kilometre>> writer(file.path);
+    writer.append(length<kilometre>(1.5));
+  }
+
+  const mapped_series<length<metre>> series(file.path);
+  REQUIRE(series.size() == 1);
+  CHECK(!series.same_unit());
+  CHECK(series.unit_ratio() == kilometre::ratio);
+  CHECK(series[0].count() == Approx(1500));
+}
+
+TEST_CASE("mapped_series reads files written in another system of units", "[mapped_series]")
+{
+  temp_file file;
+
+  SECTION("base dimension")
+  {
+    {
+      series_writer<length<metre>> writer(file.path);
+      writer.append(length<metre>(1.5));
+    }
+
+    const mapped_series<cgs::length<cgs::centimetre>> series(file.path);
+    REQUIRE(series.size() == 1);
+    CHECK(!series.same_unit());
+    CHECK(series[0].count() == Approx(150));
+  }
+
+  SECTION("derived dimension")
+  {
+    {
+      series_writer<force<newton, std::int64_t>> writer(file.path);
+      writer.append(force<newton, std::int64_t>(3));
+    }
+
+    const mapped_series<cgs::force<cgs::dyne, std::int64_t>> series(file.path);
+    REQUIRE(series.size() == 1);
+    CHECK(series[0].count() == 300'000);
+  }
+
+  SECTION("the same unit")
+  {
+    {
+      series_writer<length<centimetre>> writer(file.path);
+      writer.append(length<centimetre>(2));
+    }
+
+    const mapped_series<cgs::length<cgs::centimetre>> series(file.path);
+    CHECK(series.same_unit());
+    CHECK(series.quantities()[0].count() == 2);
+  }
+}
+
+TEST_CASE("mapped_series scales integral values exactly", "[mapped_series]")
+{
+  using us_foot = units::physical::si::us::foot;
+  temp_file file;
+  {
+    series_writer<length<us_foot, std::int64_t>> writer(file.path);
+    writer.append(length<us_foot, std::int64_t>(9'223'372'036'854'775'802));
+    writer.append(length<us_foot, std::int64_t>(-9'223'372'036'854'775'802));
+    writer.append(length<us_foot, std::int64_t>(std::numeric_limits<std::int64_t>::max()));
+    writer.append(length<us_foot, std::int64_t>(std::numeric_limits<std::int64_t>::min()));
+    writer.append(length<us_foot, std::int64_t>(3937));
+  }
+
+  const mapped_series<length<metre, std::int64_t>> series(file.path);
+  REQUIRE(series.size() == 5);
+  CHECK(series[0].count() == 2'811'289'419'412'174'488);
+  CHECK(series[1].count() == -2'811'289'419'412'174'488);
+  CHECK(series[2].count() == 2'811'289'419'412'174'490);
+  CHECK(series[3].count() == -2'811'289'419'412'174'490);
+  CHECK(series[4].count() == 1200);
+}
+
+TEST_CASE("mapped_series rejects incompatible files", "[mapped_series]")
+{
+  temp_file file;
+  {
+    series_writer<length<metre>> writer(file.path);
+    writer.append(length<metre>(1));
+  }
+
+  CHECK_THROWS_AS(mapped_series<units::physical::si::time<second>>(file.path), std::runtime_error);
+  using int_length = length<metre, std::int64_t>;
+  CHECK_THROWS_AS(mapped_series<int_length>(file.path), std::runtime_error);
+  CHECK_THROWS_AS(series_writer<length<kilometre>>(file.path), std::runtime_error);
+  CHECK_THROWS_AS(mapped_series<length<metre>>(file.path.string() + ".missing"), std::system_error);
+}
+
+#endif  // __has_include(<sys/mman.h>)
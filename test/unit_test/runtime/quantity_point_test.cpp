@@ -0,0 +1,60 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/physical/si/si.h"
+#include "units/physical/si/us/us.h"
+#include <catch2/catch.hpp>
+#include <span>
+#include <vector>
+
+using namespace units;
+using namespace units::physical::si;
+using namespace units::physical::si::us::literals;
+
+TEST_CASE("quantity_point_cast of spans converts between origins", "[quantity_point]")
+{
+  std::vector<kelvin_point<float>> readings;
+  for (int i = 0; i < 100; ++i) readings.emplace_back(thermodynamic_temperature<kelvin, float>(250.f + static_cast<float>(i)));
+
+  std::vector<celsius_point<float>> celsius(readings.size());
+  const auto res = quantity_point_cast<celsius_point<float>>(std::span<const kelvin_point<float>>(readings), std::span(celsius));
+  REQUIRE(res.data() == celsius.data());
+  for (std::size_t i = 0; i < readings.size(); ++i)
+    REQUIRE(celsius[i].relative().count() == Approx(readings[i].relative().count() - 273.15f));
+
+  std::vector<us::fahrenheit_point<float>> fahrenheit(readings.size());
+  quantity_point_cast<us::fahrenheit_point<float>>(std::span<const celsius_point<float>>(celsius), std::span(fahrenheit));
+  for (std::size_t i = 0; i < readings.size(); ++i)
+    REQUIRE(fahrenheit[i].relative().count() == Approx(celsius[i].relative().count() * 1.8f + 32));
+}
+
+TEST_CASE("quantity_point_cast of spans in place", "[quantity_point]")
+{
+  std::vector<us::fahrenheit_point<double>> readings{us::fahrenheit_point<double>(32._q_deg_F),
+                                                     us::fahrenheit_point<double>(212._q_deg_F),
+                                                     us::fahrenheit_point<double>(-40._q_deg_F)};
+  const std::span<celsius_point<double>> celsius = quantity_point_cast<celsius_point<double>>(std::span(readings));
+  REQUIRE(celsius.size() == 3);
+  CHECK(celsius[0].relative().count() == Approx(0).margin(1e-12));
+  CHECK(celsius[1].relative().count() == Approx(100));
+  CHECK(celsius[2].relative().count() == Approx(-40));
+}
@@ -0,0 +1,96 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/quantity_span.h"
+#include "units/physical/si/base/length.h"
+#include "units/physical/si/base/time.h"
+#include <catch2/catch.hpp>
+#include <array>
+#include <utility>
+#include <vector>
+
+using namespace units;
+using namespace units::physical::si;
+
+static_assert(RepLayoutQuantity<length<metre>>);
+static_assert(RepLayoutQuantity<const length<metre, float>>);
+static_assert(RepLayoutQuantity<physical::si::time<second, int>>);
+static_assert(!RepLayoutQuantity<double>);
+
+static_assert(std::is_same_v<decltype(as_quantities<length<metre>>(std::span<double>())), quantity_span<length<metre>>>);
+static_assert(std::is_same_v<decltype(as_quantities<length<metre>>(std::declval<std::span<const double, 3>>())),
+                             quantity_span<const length<metre>, 3>>);
+static_assert(std::is_same_v<decltype(as_reps(quantity_span<length<metre, float>>())), std::span<float>>);
+static_assert(std::is_same_v<decltype(as_reps(std::declval<quantity_span<const length<metre>, 2>>())), std::span<const double, 2>>);
+
+TEST_CASE("'as_quantities()' views a buffer of numbers as quantities", "[quantity_span]")
+{
+  std::vector<double> buffer{1.0, 2.5, -3.0};
+
+  SECTION ("values are accessible as quantities") {
+    const quantity_span<const length<metre>> view = as_quantities<length<metre>>(std::span<const double>(buffer));
+    REQUIRE(view.size() == 3);
+    CHECK(view[0] == 1_q_m);
+    CHECK(view[1] == 2.5_q_m);
+    CHECK(view[2] == -3_q_m);
+  }
+
+  SECTION ("modifying quantities modifies the buffer") {
+    const quantity_span<length<metre>> view = as_quantities<length<metre>>(std::span(buffer));
+    view[1] *= 2;
+    view[2] = 4_q_km;
+    CHECK(buffer[1] == 5.0);
+    CHECK(buffer[2] == 4000.0);
+  }
+}
+
+TEST_CASE("'as_reps()' views quantities as numbers", "[quantity_span]")
+{
+  std::array<length<metre, int>, 2> quantities{1_q_m, 2_q_m};
+  const std::span<int, 2> reps = as_reps(std::span(quantities));
+  CHECK(reps[0] == 1);
+  CHECK(reps[1] == 2);
+
+  reps[0] = 42;
+  CHECK(quantities[0] == 42_q_m);
+}
+
+TEST_CASE("in-place 'quantity_cast()' converts quantities in their storage", "[quantity_span][cast]")
+{
+  SECTION ("the same representation type") {
+    std::vector<length<millimetre, int>> frame{1500_q_mm, -2500_q_mm, 3_q_mm};
+    const std::span<length<metre, int>> m = quantity_cast<length<metre, int>>(std::span(frame));
+    REQUIRE(m.size() == 3);
+    CHECK(static_cast<void*>(m.data()) == static_cast<void*>(frame.data()));
+    CHECK(m[0] == 1_q_m);
+    CHECK(m[1] == -2_q_m);
+    CHECK(m[2] == 0_q_m);
+  }
+
+  SECTION ("different representation types") {
+    std::vector<length<millimetre, float>> frame{length<millimetre, float>(1500.f), length<millimetre, float>(-2500.f)};
+    const std::span<length<metre, int>> m = quantity_cast<length<metre, int>>(std::span(frame));
+    REQUIRE(m.size() == 2);
+    CHECK(m[0] == 1_q_m);
+    CHECK(m[1] == -2_q_m);
+  }
+}
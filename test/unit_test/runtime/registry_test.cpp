@@ -0,0 +1,83 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/registry.h"
+#include <catch2/catch.hpp>
+#include <string>
+
+using namespace units;
+using namespace units::physical;
+
+TEST_CASE("registry finds units by symbols", "[registry]")
+{
+  const unit_info* kmh = registry::find("km/h");
+  REQUIRE(kmh != nullptr);
+  CHECK(kmh->standard_symbol == "km/h");
+  CHECK(kmh->dimension_id == dimension_id<si::dim_speed>);
+  CHECK(kmh->dimension == packed_dimension::of<si::dim_speed>());
+  CHECK(kmh->unit_ratio == si::kilometre_per_hour::ratio);
+  CHECK(kmh->factor == Approx(1. / 3.6));
+
+  const unit_info* us = registry::find("us");
+  REQUIRE(us != nullptr);
+  CHECK(us == registry::find("µs"));
+  CHECK(us->dimension_id == dimension_id<si::dim_time>);
+
+  CHECK(registry::find("kg")->factor == Approx(1000));
+  CHECK(registry::find("KiB")->dimension_id == dimension_id<data::dim_information>);
+  CHECK(registry::find("dyn")->dimension == packed_dimension::of<si::dim_force>());
+  CHECK(registry::find("ft")->factor == Approx(0.3048));
+}
+
+TEST_CASE("registry does not find unknown symbols", "[registry]")
+{
+  CHECK(registry::find("") == nullptr);
+  CHECK(registry::find("xyz") == nullptr);
+  CHECK(registry::find("km/") == nullptr);
+  CHECK(registry::find("KM") == nullptr);
+}
+
+TEST_CASE("registry does not contain units with non-zero origins", "[registry]")
+{
+  CHECK(registry::find("K") != nullptr);
+  CHECK(registry::find("°C") == nullptr);
+  CHECK(registry::find("deg_C") == nullptr);
+  CHECK(registry::find("°F") == nullptr);
+  CHECK(registry::find("deg_F") == nullptr);
+}
+
+TEST_CASE("registry finds every registered unit", "[registry]")
+{
+  for (const unit_info& u : registry::entries()) {
+    CHECK(registry::find(u.standard_symbol) != nullptr);
+    CHECK(registry::find(u.ascii_symbol) != nullptr);
+    CHECK(registry::find(u.standard_symbol)->factor == u.factor);
+  }
+}
+
+TEST_CASE("registry creates dynamic quantities", "[registry]")
+{
+  const std::string config = "km/h";
+  const dynamic_quantity v = (*registry::find(config))(72);
+  CHECK(quantity_cast<si::speed<si::metre_per_second>>(v).count() == Approx(20));
+  CHECK_THROWS_AS(quantity_cast<si::length<si::metre>>(v), std::invalid_argument);
+}
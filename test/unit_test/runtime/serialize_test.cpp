@@ -0,0 +1,167 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/physical/si/si.h"
+#include "units/serialize.h"
+#include <catch2/catch.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace units;
+using namespace units::physical::si;
+
+TEST_CASE("serialize writes little-endian values", "[serialize]")
+{
+  std::array<std::byte, 16> buf{};
+  const auto end = serialize(length<metre, std::int32_t>(0x01020304), buf.data(), wire_format::untagged);
+  CHECK(end == buf.data() + 4);
+  CHECK(buf[0] == std::byte{0x04});
+  CHECK(buf[1] == std::byte{0x03});
+  CHECK(buf[2] == std::byte{0x02});
+  CHECK(buf[3] == std::byte{0x01});
+
+  serialize(length<metre, std::int32_t>(1), buf.data());
+  std::uint64_t tag = 0;
+  for (std::size_t i = 8; i > 0; --i) tag = (tag << 8) | std::to_integer<std::uint64_t>(buf[i - 1]);
+  CHECK(tag == unit_id<dim_length, metre>);
+  CHECK(buf[8] == std::byte{'i'});
+  CHECK(buf[9] == std::byte{4});
+}
+
+TEST_CASE("deserialize of a single quantity", "[serialize]")
+{
+  std::array<std::byte, serialized_size<length<kilometre>>()> buf{};
+
+  SECTION("the same unit")
+  {
+    serialize(length<kilometre>(2.5), buf.data());
+    length<kilometre> q;
+    const auto res = deserialize(buf.data(), buf.data() + buf.size(), q);
+    CHECK(res.ec == std::errc());
+    CHECK(res.ptr == buf.data() + buf.size());
+    CHECK(q == 2.5_q_km);
+  }
+
+  SECTION("a different accepted unit is converted")
+  {
+    serialize(length<kilometre>(2.5), buf.data());
+    length<metre> q;
+    const auto res = deserialize<length<metre>, kilometre>(buf.data(), buf.data() + buf.size(), q);
+    CHECK(res.ec == std::errc());
+    CHECK(q.count() == 2500);
+  }
+
+  SECTION("a not accepted unit is an error")
+  {
+    serialize(length<kilometre>(2.5), buf.data());
+    length<metre> q;
+    const auto res = deserialize(buf.data(), buf.data() + buf.size(), q);
+    CHECK(res.ec == std::errc::invalid_argument);
+    CHECK(res.ptr == buf.data());
+  }
+
+  SECTION("a different dimension is an error")
+  {
+    serialize(units::physical::si::time<second>(2.5), buf.data());
+    length<metre> q;
+    const auto res = deserialize<length<metre>, kilometre>(buf.data(), buf.data() + buf.size(), q);
+    CHECK(res.ec == std::errc::invalid_argument);
+  }
+
+  SECTION("a different representation type is an error")
+  {
+    std::array<std::byte, serialized_size<length<kilometre, std::int64_t>>()> ibuf{};
+    serialize(length<kilometre, std::int64_t>(2), ibuf.data());
+    length<kilometre> q;
+    const auto res = deserialize(ibuf.data(), ibuf.data() + ibuf.size(), q);
+    CHECK(res.ec == std::errc::invalid_argument);
+    CHECK(res.ptr == ibuf.data());
+
+    std::array<std::byte, serialized_size<length<kilometre, float>>()> fbuf{};
+    serialize(length<kilometre, float>(2.5f), fbuf.data());
+    const auto fres = deserialize(fbuf.data(), fbuf.data() + fbuf.size(), q);
+    CHECK(fres.ec == std::errc::invalid_argument);
+  }
+
+  SECTION("a truncated input is an error")
+  {
+    serialize(length<kilometre>(2.5), buf.data());
+    length<kilometre> q;
+    const auto res = deserialize(buf.data(), buf.data() + buf.size() - 1, q);
+    CHECK(res.ec == std::errc::message_size);
+  }
+
+  SECTION("untagged")
+  {
+    serialize(length<kilometre>(2.5), buf.data(), wire_format::untagged);
+    length<kilometre> q;
+    const auto res = deserialize(buf.data(), buf.data() + 8, q, wire_format::untagged);
+    CHECK(res.ec == std::errc());
+    CHECK(res.ptr == buf.data() + 8);
+    CHECK(q == 2.5_q_km);
+  }
+}
+
+TEST_CASE("serialize of a sequence of quantities", "[serialize]")
+{
+  const std::vector<length<kilometre>> v = {1._q_km, 2._q_km, 3.5_q_km};
+  std::array<std::byte, serialized_size<length<kilometre>>(3)> buf{};
+  const auto end = serialize(std::span(v), buf.data());
+  CHECK(end == buf.data() + buf.size());
+
+  SECTION("the same unit")
+  {
+    std::array<length<kilometre>, 4> out{};
+    const auto res = deserialize(buf.data(), buf.data() + buf.size(), std::span(out));
+    CHECK(res.ec == std::errc());
+    CHECK(res.size == 3);
+    CHECK(res.ptr == buf.data() + buf.size());
+    CHECK(out[2] == 3.5_q_km);
+  }
+
+  SECTION("a different accepted unit is converted")
+  {
+    std::array<length<metre>, 3> out{};
+    const auto res = deserialize<length<metre>, kilometre>(buf.data(), buf.data() + buf.size(), std::span(out));
+    CHECK(res.ec == std::errc());
+    CHECK(res.size == 3);
+    CHECK(out[0].count() == 1000);
+    CHECK(out[2].count() == 3500);
+  }
+
+  SECTION("a too small output is an error")
+  {
+    std::array<length<kilometre>, 2> out{};
+    const auto res = deserialize(buf.data(), buf.data() + buf.size(), std::span(out));
+    CHECK(res.ec == std::errc::result_out_of_range);
+    CHECK(res.ptr == buf.data());
+  }
+
+  SECTION("a truncated input is an error")
+  {
+    std::array<length<kilometre>, 3> out{};
+    const auto res = deserialize(buf.data(), buf.data() + buf.size() - 1, std::span(out));
+    CHECK(res.ec == std::errc::message_size);
+  }
+}
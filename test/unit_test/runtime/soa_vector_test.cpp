@@ -0,0 +1,100 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/soa_vector.h"
+#include "units/physical/si/base/length.h"
+#include "units/physical/si/base/time.h"
+#include "units/quantity_point.h"
+#include <catch2/catch.hpp>
+#include <iterator>
+#include <numeric>
+
+using namespace units;
+using namespace units::physical::si;
+
+namespace {
+
+using track = soa_vector<physical::si::time<second>, length<kilometre>, quantity_point<dim_length, metre>>;
+
+static_assert(std::is_same_v<decltype(std::declval<track&>().column<1>()), quantity_span<length<kilometre>>>);
+static_assert(std::is_same_v<decltype(std::declval<const track&>().column<0>()), quantity_span<const physical::si::time<second>>>);
+static_assert(std::is_same_v<decltype(get<2>(std::declval<track&>()[0])), quantity_point<dim_length, metre>&>);
+static_assert(std::random_access_iterator<track::iterator>);
+static_assert(std::random_access_iterator<track::const_iterator>);
+static_assert(std::is_same_v<std::iterator_traits<track::iterator>::iterator_category, std::input_iterator_tag>);
+
+}  // namespace
+
+TEST_CASE("'soa_vector' stores every field in its own column", "[soa_vector]")
+{
+  track t;
+  REQUIRE(t.empty());
+
+  t.reserve(3);
+  CHECK(t.capacity() >= 3);
+
+  t.push_back(0._q_s, 0._q_km, quantity_point(500._q_m));
+  t.push_back({10._q_s, 1._q_km, quantity_point(600._q_m)});
+  t.push_back(20._q_s, 3._q_km, quantity_point(550._q_m));
+  REQUIRE(t.size() == 3);
+
+  SECTION ("columns are contiguous ranges of quantities") {
+    const auto distances = t.column<1>();
+    REQUIRE(distances.size() == 3);
+    CHECK(std::accumulate(distances.begin(), distances.end(), 0._q_km) == 4._q_km);
+    CHECK(&distances[1] == &distances[0] + 1);
+  }
+
+  SECTION ("proxy references behave like a structure") {
+    auto [dur, dist, alt] = t[1];
+    CHECK(dur == 10._q_s);
+    CHECK(dist == 1._q_km);
+    CHECK(alt == quantity_point(600._q_m));
+
+    dist = 2._q_km;
+    CHECK(t.column<1>()[1] == 2._q_km);
+
+    t[0] = t[2];
+    CHECK(t[0] == t[2]);
+    CHECK(std::get<0>(track::value_type(t[0])) == 20._q_s);
+  }
+
+  SECTION ("iteration visits all records in order") {
+    std::size_t count = 0;
+    for (const auto& ref : std::as_const(t)) {
+      CHECK(ref.get<0>() == t.column<0>()[count]);
+      ++count;
+    }
+    CHECK(count == 3);
+    CHECK(t.end() - t.begin() == 3);
+  }
+
+  SECTION ("resize and clear change all the columns") {
+    t.resize(5);
+    CHECK(t.size() == 5);
+    CHECK(t.column<2>().size() == 5);
+    t.pop_back();
+    CHECK(t.back().get<1>() == 0._q_km);
+    t.clear();
+    CHECK(t.empty());
+  }
+}
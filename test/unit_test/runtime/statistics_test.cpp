@@ -0,0 +1,130 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/statistics.h"
+#include "units/physical/si/derived/area.h"
+#include "units/physical/si/derived/power.h"
+#include "units/physical/si/derived/speed.h"
+#include <catch2/catch.hpp>
+#include <random>
+#include <vector>
+
+using namespace units;
+using namespace units::physical::si;
+
+static_assert(std::is_same_v<statistics<speed<metre_per_second, float>>::value_type, speed<metre_per_second, float>>);
+static_assert(std::is_same_v<statistics<speed<metre_per_second, int>>::value_type, speed<metre_per_second, double>>);
+static_assert(std::is_same_v<statistics<length<kilometre>>::variance_type::dimension, dim_area>);
+
+TEST_CASE("'statistics' accumulates samples of quantities", "[statistics]")
+{
+  statistics<speed<metre_per_second>> stats;
+  REQUIRE(stats.empty());
+
+  for (const auto v : {2., 4., 4., 4., 5., 5., 7., 9.}) stats.add(speed<metre_per_second>(v));
+
+  SECTION ("count, sum, min and max") {
+    CHECK(stats.count() == 8);
+    CHECK(stats.sum() == 40_q_m_per_s);
+    CHECK(stats.min() == 2_q_m_per_s);
+    CHECK(stats.max() == 9_q_m_per_s);
+  }
+
+  SECTION ("mean and variance are properly dimensioned") {
+    CHECK(stats.mean() == 5_q_m_per_s);
+    CHECK(stats.variance() == 4 * (1_q_m_per_s * 1_q_m_per_s));
+    CHECK(stats.stddev() == 2_q_m_per_s);
+    CHECK(stats.sample_variance().count() == Approx(32. / 7));
+  }
+
+  SECTION ("quantiles are approximate within the relative accuracy") {
+    CHECK(stats.quantile(0).count() == 2);
+    CHECK(stats.quantile(1).count() == 9);
+    CHECK(stats.quantile(0.5).count() == Approx(4.5).epsilon(0.12));
+  }
+}
+
+TEST_CASE("'statistics' uses a compensated sum", "[statistics]")
+{
+  statistics<power<watt, float>> stats;
+  stats.add(power<watt, float>(1e8f));
+  for (int i = 0; i < 1000; ++i) stats.add(power<watt, float>(1.f));
+  stats.add(power<watt, float>(-1e8f));
+  CHECK(stats.sum().count() == 1000.f);
+}
+
+TEST_CASE("'statistics' of float quantities accumulate with double precision", "[statistics]")
+{
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<float> dist(0.f, 1.f);
+  std::vector<float> samples(1'000'000);
+  for (auto& s : samples) s = 1000.f + dist(gen);
+
+  double sum = 0;
+  for (const float s : samples) sum += static_cast<double>(s);
+  const double mean = sum / static_cast<double>(samples.size());
+  double m2 = 0;
+  for (const float s : samples) m2 += (static_cast<double>(s) - mean) * (static_cast<double>(s) - mean);
+
+  statistics<length<metre, float>> stats;
+  for (const float s : samples) stats.add(length<metre, float>(s));
+  CHECK(static_cast<double>(stats.mean().count()) == Approx(mean).epsilon(1e-7));
+  CHECK(static_cast<double>(stats.variance().count()) == Approx(m2 / static_cast<double>(samples.size())).epsilon(1e-6));
+}
+
+TEST_CASE("merged 'statistics' give the same results as a single accumulator", "[statistics]")
+{
+  std::mt19937 gen(42);
+  std::normal_distribution<double> dist(100., 15.);
+  std::vector<length<metre>> samples(10'000);
+  for (auto& s : samples) s = length<metre>(dist(gen));
+
+  statistics<length<metre>> all;
+  statistics<length<metre>> a;
+  statistics<length<metre>> b;
+  for (std::size_t i = 0; i < samples.size(); ++i) {
+    all.add(samples[i]);
+    (i % 3 == 0 ? a : b).add(samples[i]);
+  }
+  a.merge(b);
+
+  CHECK(a.count() == all.count());
+  CHECK(a.sum().count() == Approx(all.sum().count()));
+  CHECK(a.mean().count() == Approx(all.mean().count()));
+  CHECK(a.variance().count() == Approx(all.variance().count()));
+  CHECK(a.min() == all.min());
+  CHECK(a.max() == all.max());
+  for (const double q : {0.01, 0.25, 0.5, 0.75, 0.99}) {
+    CHECK(a.quantile(q) == all.quantile(q));
+  }
+  CHECK(all.quantile(0.5).count() == Approx(100.).epsilon(0.02));
+}
+
+TEST_CASE("'statistics' handles negative values and zeros", "[statistics]")
+{
+  statistics<length<metre, int>> stats;
+  for (const int v : {-100, -10, 0, 0, 10, 100, 1000}) stats.add(length<metre, int>(v));
+  CHECK(stats.quantile(0.).count() == -100);
+  CHECK(stats.quantile(1. / 6).count() == Approx(-10).epsilon(0.01));
+  CHECK(stats.quantile(0.5).count() == 0);
+  CHECK(stats.quantile(5. / 6).count() == Approx(100).epsilon(0.01));
+}
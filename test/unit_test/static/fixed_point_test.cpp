@@ -0,0 +1,105 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "test_tools.h"
+#include <units/fixed_point.h>
+#include <units/physical/si/derived/speed.h>
+
+namespace {
+
+using namespace units;
+using namespace units::physical::si;
+
+using q16_16 = fixed_point<std::int32_t, ratio(1, 65536)>;
+using milli = fixed_point<std::int32_t, ratio(1, 1, -3)>;
+using fp32 = fixed_point<std::int32_t>;
+
+static_assert(QuantityValue<q16_16>);
+static_assert(QuantityValue<fixed_point<std::int64_t, ratio(1, 1, -9)>>);
+static_assert(!treat_as_floating_point<q16_16>);
+
+// construction
+static_assert(q16_16(3).raw() == 3 * 65536);
+static_assert(q16_16(1.5).raw() == 98304);
+static_assert(milli(0.0029).raw() == 3);  // rounded to nearest
+static_assert(milli(-0.0029).raw() == -3);
+static_assert(milli(0.0021).raw() == 2);
+static_assert(q16_16::from_raw(98304) == q16_16(1.5));
+static_assert(milli(2).raw() == 2000);
+static_assert(std::convertible_to<int, milli>);
+static_assert(!std::convertible_to<std::int64_t, milli>);  // narrowing
+static_assert(!std::convertible_to<int, fixed_point<int, ratio(10)>>);  // truncating
+static_assert(!std::convertible_to<double, milli>);
+static_assert(static_cast<double>(q16_16::from_raw(98304)) == 1.5);
+
+// conversions between scales
+static_assert(std::convertible_to<fp32, milli>);
+static_assert(!std::convertible_to<milli, fp32>);
+static_assert(milli(fp32(7)).raw() == 7000);
+static_assert(fp32(milli::from_raw(7999)).raw() == 7);
+static_assert(fp32(milli::from_raw(-7999)).raw() == -7);
+
+// arithmetic
+static_assert((q16_16(1.5) + q16_16(2)).raw() == 3 * 65536 + 32768);
+static_assert((milli(1) - milli::from_raw(1)).raw() == 999);
+static_assert((milli(3) * 2).raw() == 6000);
+static_assert((milli(3) / 2).raw() == 1500);
+static_assert(is_same_v<decltype(milli(1) * fp32(2)), milli>);
+static_assert(is_same_v<decltype(milli(1) * milli(2)), milli>);
+static_assert(is_same_v<decltype(q16_16(1) / fp32(2)), q16_16>);
+static_assert(q16_16(1) * q16_16(3) == q16_16(3));
+static_assert(q16_16(1.5) * q16_16(2.5) == q16_16(3.75));
+static_assert(q16_16(-1.5) * q16_16(100) == q16_16(-150));
+static_assert(q16_16(3) / q16_16(2) == q16_16(1.5));
+static_assert(q16_16(1) / q16_16(4) == q16_16(0.25));
+static_assert(q16_16(-7) / q16_16(2) == q16_16(-3.5));
+static_assert(milli(1.5) * milli(2.5) == milli(3.75));
+static_assert(milli(1) / milli(8) == milli(0.125));
+static_assert(milli(3) / fp32(2) == milli(1.5));
+static_assert(fixed_point<std::int64_t, ratio(1, 1, -9)>(3000) * fixed_point<std::int64_t, ratio(1, 1, -9)>(3000) ==
+              fixed_point<std::int64_t, ratio(1, 1, -9)>(9'000'000));
+static_assert(milli(1) + fp32(2) == milli(3));
+static_assert(milli(1) < fp32(2));
+
+// common type
+static_assert(is_same_v<std::common_type_t<milli, milli>, milli>);
+static_assert(is_same_v<std::common_type_t<fixed_point<std::int16_t>, fp32>, fp32>);
+static_assert(is_same_v<std::common_type_t<milli, fp32>, fixed_point<std::intmax_t, ratio(1, 1, -3)>>);
+static_assert(is_same_v<std::common_type_t<milli, double>, double>);
+
+// quantities
+static_assert(length<millimetre, fp32>(1500) + length<metre, fp32>(1) == length<millimetre, fp32>(2500));
+static_assert((length<metre, milli>(2) * 3).count() == milli(6));
+static_assert(length<metre, milli>::zero().count().raw() == 0);
+static_assert(length<metre, milli>::one().count().raw() == 1000);
+static_assert(length<metre, milli>::max().count().raw() == std::numeric_limits<std::int32_t>::max());
+
+// quantity_cast folds the unit ratio into the change of scale
+static_assert(quantity_cast<length<metre, milli>>(length<millimetre, fp32>(1500)).count().raw() == 1500);
+static_assert(quantity_cast<length<millimetre, fp32>>(length<metre, milli>(milli::from_raw(1500))).count().raw() == 1500);
+static_assert(quantity_cast<length<metre, fp32>>(length<millimetre, fp32>(1500)).count().raw() == 1);
+static_assert(quantity_cast<length<millimetre, fp32>>(length<metre, q16_16>(q16_16(1.5))).count().raw() == 1500);
+static_assert(quantity_cast<metre>(length<kilometre, milli>(milli::from_raw(1234))).count().raw() == 1'234'000);
+static_assert(quantity_cast<length<metre, double>>(length<millimetre, q16_16>(q16_16(1.5))).count() == 0.0015);
+static_assert(quantity_cast<speed<kilometre_per_hour, fp32>>(speed<metre_per_second, milli>(milli(10))).count() == fp32(36));
+
+}  // namespace
@@ -0,0 +1,54 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "units/hash.h"
+#include "units/physical/si/cgs/cgs.h"
+#include "units/physical/si/si.h"
+
+namespace {
+
+using namespace units;
+using namespace units::physical;
+
+// dimension_id
+static_assert(dimension_id<si::dim_length> == dimension_id<si::dim_length>);
+static_assert(dimension_id<si::dim_length> != dimension_id<si::dim_time>);
+static_assert(dimension_id<si::dim_length> != dimension_id<si::dim_area>);
+static_assert(dimension_id<si::dim_speed> != dimension_id<si::dim_acceleration>);
+static_assert(dimension_id<si::dim_frequency> != dimension_id<si::dim_time>);
+static_assert(dimension_id<si::dim_length> != dimension_id<si::cgs::dim_length>);
+static_assert(dimension_id<si::dim_speed> ==
+              dimension_id<dimension_divide<si::dim_length, si::dim_time>>);
+static_assert(dimension_id<si::dim_energy> ==
+              dimension_id<dimension_multiply<si::dim_force, si::dim_length>>);
+
+// unit_id
+static_assert(unit_id<si::dim_length, si::metre> != unit_id<si::dim_length, si::kilometre>);
+static_assert(unit_id<si::dim_length, si::metre> != unit_id<si::dim_time, si::second>);
+static_assert(unit_id<si::dim_speed, si::metre_per_second> != unit_id<si::dim_speed, si::kilometre_per_hour>);
+static_assert(unit_id<si::dim_frequency, si::hertz> != unit_id<si::dim_time, si::second>);
+
+// identifiers are stable across compilers and builds
+static_assert(dimension_id<si::dim_length> == 0xf5295de880384b0f);
+static_assert(unit_id<si::dim_speed, si::kilometre_per_hour> == 0xea030fd709391084);
+
+}  // namespace
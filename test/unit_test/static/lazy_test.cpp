@@ -0,0 +1,64 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "test_tools.h"
+#include <units/lazy.h>
+#include <units/physical/si/derived/energy.h>
+#include <units/physical/si/derived/speed.h>
+
+namespace {
+
+using namespace units;
+using namespace units::physical;
+using namespace units::physical::si::literals;
+
+// creation
+static_assert(is_same_v<decltype(lazy(1_q_m))::quantity_type, si::length<si::metre, std::int64_t>>);
+static_assert(is_same_v<decltype(lazy(1_q_km) + 1_q_m)::quantity_type, si::length<si::metre, std::int64_t>>);
+static_assert(is_same_v<decltype(lazy(1_q_km) + 1_q_m + 1._q_mm)::quantity_type, si::length<si::millimetre, long double>>);
+
+// evaluation
+static_assert(lazy(1_q_m).eval() == 1_q_m);
+static_assert((lazy(1_q_km) + 2_q_m + 3_q_mm + 4_q_um).eval().count() == 1'002'003'004);
+static_assert((lazy(1_q_km) - 2_q_m - 3_q_mm).eval() == 997'997_q_mm);
+static_assert((1_q_km - lazy(2_q_m) + 3_q_mm).eval() == 998'003_q_mm);
+static_assert((-(lazy(1_q_m) - 2_q_cm)).eval() == -98_q_cm);
+static_assert((lazy(1_q_m) + 2_q_cm - (lazy(3_q_mm) - 4_q_um)).eval() == 1'017'004_q_um);
+static_assert(is_same_v<decltype((1_q_km - lazy(2_q_m)).eval()), decltype(1_q_km - 2_q_m)>);
+
+// implicit conversion
+static_assert([] {
+  const si::length<si::micrometre, std::int64_t> l = lazy(1_q_km) + 2_q_m + 3_q_mm + 4_q_um;
+  return l == 1'002'003'004_q_um;
+}());
+
+// dot-product-like expressions
+static_assert((lazy(2_q_N * 3_q_m) + 4_q_N * 5_q_km + 6_q_kN * 7_q_mm).eval() == 20'048_q_J);
+
+// only quantities of equivalent dimensions can be added
+template<typename L, typename Q>
+concept can_be_added = requires(L l, Q q) { l + q; };
+
+static_assert(can_be_added<decltype(lazy(1_q_m)), si::length<si::kilometre, int>>);
+static_assert(!can_be_added<decltype(lazy(1_q_m)), si::time<si::second, int>>);
+
+}  // namespace
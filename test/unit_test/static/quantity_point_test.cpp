@@ -27,6 +27,7 @@
 #include "units/physical/si/derived/speed.h"
 #include "units/physical/si/derived/volume.h"
 #include "units/physical/si/us/base/length.h"
+#include "units/physical/si/us/base/thermodynamic_temperature.h"
 #include <chrono>
 #include <utility>
 
@@ -251,4 +252,52 @@ concept dimensional_analysis = requires(T t)
 
 static_assert(!dimensional_analysis<quantity_point<dim_length, metre, int>>);
 
+// origins
+
+static_assert(std::is_same_v<quantity_point<dim_length, metre>::origin, zero_origin>);
+static_assert(std::is_same_v<celsius_point<>::origin, ice_point>);
+static_assert(std::is_same_v<quantity_point<dim_thermodynamic_temperature, degree_celsius>::origin, ice_point>);
+static_assert(std::is_same_v<quantity_point<dim_thermodynamic_temperature, us::degree_fahrenheit>::origin, us::fahrenheit_zero>);
+static_assert(compare<decltype(quantity_point(20._q_deg_C)), celsius_point<long double>>);
+static_assert(compare<decltype(quantity_point(20_q_deg_F)), us::fahrenheit_point<std::int64_t>>);
+static_assert(compare<decltype(quantity_point(20_q_K)), kelvin_point<std::int64_t>>);
+static_assert(PointOrigin<zero_origin>);
+static_assert(PointOrigin<ice_point>);
+static_assert(!PointOrigin<kelvin>);
+
+template<typename T>
+concept different_origins_do_not_mix = !requires(kelvin_point<T> k, celsius_point<T> c) {
+  k - c;
+  k == c;
+  k < c;
+  kelvin_point<T>(c);
+};
+
+static_assert(different_origins_do_not_mix<double>);
+
+static_assert(celsius_point<>(20_q_deg_C) - celsius_point<>(10_q_deg_C) == 10_q_K);
+static_assert(celsius_point<>(20_q_deg_C) + 5_q_K == celsius_point<>(25_q_deg_C));
+
+static_assert(compare<decltype(quantity_point_cast<celsius_point<>>(kelvin_point<>(300._q_K))), celsius_point<>>);
+static_assert(compare<decltype(quantity_point_cast<kelvin>(celsius_point<>(20._q_deg_C))),
+                      quantity_point<dim_thermodynamic_temperature, kelvin, double, ice_point>>);
+static_assert(quantity_point_cast<kelvin_point<long double>>(celsius_point<long double>(0._q_deg_C)).relative().count() ==
+              273.15L);
+static_assert(quantity_point_cast<us::fahrenheit_point<long double>>(celsius_point<long double>(100._q_deg_C)).relative().count() ==
+              212);
+static_assert(quantity_point_cast<celsius_point<long double>>(us::fahrenheit_point<long double>(-40._q_deg_F)).relative().count() ==
+              -40);
+static_assert(quantity_point_cast<celsius_point<long double>>(quantity_point(20._q_deg_C)).relative().count() == 20);
+static_assert(quantity_point_cast<kelvin_point<long double>>(quantity_point(20._q_deg_C)).relative().count() == 293.15L);
+
+static_assert(quantity_point_cast<us::fahrenheit_point<int>>(celsius_point<int>(thermodynamic_temperature<degree_celsius, int>(100)))
+                .relative().count() == 212);
+static_assert(quantity_point_cast<us::fahrenheit_point<int>>(celsius_point<int>(thermodynamic_temperature<degree_celsius, int>(-40)))
+                .relative().count() == -40);
+
+struct boiling_point : point_origin<zero_origin, kelvin, ratio(37'315, 100)> {};
+
+static_assert(quantity_point_cast<quantity_point<dim_thermodynamic_temperature, degree_celsius, int, boiling_point>>(
+                celsius_point<int>(thermodynamic_temperature<degree_celsius, int>(20))).relative().count() == -80);
+
 }  // namespace
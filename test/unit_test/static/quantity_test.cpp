@@ -28,9 +28,11 @@
 #include "units/physical/si/derived/speed.h"
 #include "units/physical/si/derived/volume.h"
 #include "units/physical/si/fps/derived/speed.h"
+#include <array>
 #include <chrono>
 #include <complex>
 #include <mutex>
+#include <span>
 #include <string>
 #include <utility>
 
@@ -680,6 +682,46 @@ static_assert(quantity_cast<kilometre>(2000_q_m).count() == 2);
 static_assert(quantity_cast<int>(1.23_q_m).count() == 1);
 static_assert(quantity_cast<dim_speed, kilometre_per_hour>(2000.0_q_m / 3600.0_q_s).count() == 2);
 
+static_assert(conversion_factor_v<length<kilometre>, length<metre>> == 1000.);
+static_assert(conversion_factor_v<length<millimetre>, length<metre>> == 0.001);
+static_assert(conversion_factor_v<fps::length<fps::foot>, length<metre>> == 0.3048);
+static_assert(conversion_factor_v<length<kilometre, int>, length<metre, int>>.multiplier == 1000);
+static_assert(conversion_factor_v<length<kilometre, int>, length<metre, int>>.divisor == 1);
+static_assert(conversion_factor_v<length<metre, int>, length<kilometre, int>>.multiplier == 1);
+static_assert(conversion_factor_v<length<metre, int>, length<kilometre, int>>.divisor == 1000);
+static_assert(conversion_factor_v<fps::length<fps::foot, int>, length<millimetre, int>>.multiplier == 1524);
+static_assert(conversion_factor_v<fps::length<fps::foot, int>, length<millimetre, int>>.divisor == 5);
+static_assert(quantity_cast<length<millimetre, int>>(fps::length<fps::foot, int>(10)).count() == 3048);
+static_assert(quantity_cast<length<metre>>(length<millimetre>(1.5)).count() == 0.0015);
+
+// integral casts do not overflow in intermediate computations
+static_assert(quantity_cast<physical::si::time<millisecond, std::int64_t>>(physical::si::time<nanosecond, std::int64_t>(INT64_MAX)).count() == INT64_MAX / 1'000'000);
+static_assert(quantity_cast<physical::si::time<millisecond, std::int64_t>>(physical::si::time<nanosecond, std::int64_t>(INT64_MIN)).count() == INT64_MIN / 1'000'000);
+static_assert(quantity_cast<physical::si::time<second, int>>(physical::si::time<millisecond, int>(-1999)).count() == -1);
+static_assert(quantity_cast<length<millimetre, std::int64_t>>(fps::length<fps::foot, std::int64_t>(10'000'000'000'000'000)).count() == 3'048'000'000'000'000'000);
+static_assert(quantity_cast<length<millimetre, std::int64_t>>(fps::length<fps::foot, std::int64_t>(-10'000'000'000'000'001)).count() == -3'048'000'000'000'000'304);
+static_assert(quantity_cast<length<millimetre, int>>(fps::length<fps::foot, int>(-7)).count() == -2133);
+static_assert(detail::scale_integral<3'000'000'019, 7'000'000'001, std::int64_t>(INT64_MAX) == 3'952'873'754'550'788'909);
+static_assert(detail::scale_integral<3'000'000'019, 7'000'000'001, std::int64_t>(INT64_MIN) == -3'952'873'754'550'788'909);
+static_assert(detail::scale_integral<3'000'000'019, 7'000'000'001, std::int64_t>(std::int64_t{123'456'789'012'345'678}) == 52'910'052'761'400'853);
+static_assert(detail::scale_integral<1, 1'000'000'000'000, std::int32_t>(INT32_MAX) == 0);
+static_assert(detail::scale_integral<1, 1'000'000'000'000, std::int32_t>(INT32_MIN) == 0);
+
+static_assert([] {
+  const std::array from{1500_q_mm, -2500_q_mm, 3_q_mm};
+  std::array<length<metre, int>, 3> to{};
+  quantity_cast<length<metre, int>>(std::span(from), std::span(to));
+  return to[0] == 1_q_m && to[1] == -2_q_m && to[2] == 0_q_m;
+}());
+
+template<typename To, typename Span>
+concept castable_in_place = requires(Span s) {
+  { quantity_cast<To>(s) } -> std::same_as<std::span<To>>;
+};
+
+static_assert(castable_in_place<length<metre, float>, std::span<length<millimetre, float>>>);
+static_assert(!castable_in_place<length<metre, double>, std::span<length<millimetre, float>>>);
+
 
 ////////////////
 // downcasting